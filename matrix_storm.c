@@ -1,5 +1,5 @@
 /*
- * matrix_rain.c
+ * matrix_storm.c
  *
  * Matrix Rain simulation with lightning effects using SDL2.
  * All comments have been standardized for clarity and consistency.
@@ -14,394 +14,587 @@
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten/emscripten.h>
+#include <emscripten/html5.h>
 #endif
 
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
 
-/* Configuration */
-#define FONT_SIZE 16
-
-/* Global window dimensions */
-int g_screen_width = 800;
-int g_screen_height = 600;
-
-/* Global physics constants */
-#define GRAVITY 10.0f
-#define TERMINAL_VELOCITY 100.0f
-#define WIND_RESPONSE 2.0f
-
-/* Unicode Characters */
-
-/* List of Unicode characters: Hiragana, Katakana, Latin, Cyrillic, Numbers,
-   Math symbols, Greek Alphabet, and Chinese characters. */
-const char* unicode_chars[] = {
-    /* Hiragana */
-    "あ", "い", "う", "え", "お",
-    "か", "き", "く", "け", "こ",
-    "さ", "し", "す", "せ", "そ",
-    "た", "ち", "つ", "て", "と",
-    "な", "に", "ぬ", "ね", "の",
-    "は", "ひ", "ふ", "へ", "ほ",
-    "ま", "み", "む", "め", "も",
-    "や", "ゆ", "よ",
-    "ら", "り", "る", "れ", "ろ",
-    "わ", "を", "ん",
-    
-    /* Katakana */
-    "ア", "イ", "ウ", "エ", "オ",
-    "カ", "キ", "ク", "ケ", "コ",
-    "サ", "シ", "ス", "セ", "ソ",
-    "タ", "チ", "ツ", "テ", "ト",
-    "ナ", "ニ", "ヌ", "ネ", "ノ",
-    "ハ", "ヒ", "フ", "ヘ", "ホ",
-    "マ", "ミ", "ム", "メ", "モ",
-    "ヤ", "ユ", "ヨ",
-    "ラ", "リ", "ル", "レ", "ロ",
-    "ワ", "ヲ", "ン",
-    
-    /* Latin */
-    "A", "B", "C", "D", "E", "F", "G", "H", "I", 
-    "J", "K", "L", "M", "N", "O", "P", "Q", "R", 
-    "S", "T", "U", "V", "W", "X", "Y", "Z", 
-    "a", "b", "c", "d", "e", "f", "g", "h", "i", 
-    "j", "k", "l", "m", "n", "o", "p", "q", "r", 
-    "s", "t", "u", "v", "w", "x", "y", "z",
-    
-    /* Cyrillic */
-    "Б", "Д", "Ж", "З", "И", "Л", "У", "Ц", 
-    "Ч", "Ш", "Щ", "Ъ", "Ь", "Э", "Ю", "Я",
-    
-    /* Numbers */
-    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
-    
-    /* Math symbols */
-    "+", "-", "×", "÷", "=", "≠", "≤", "≥", "±", 
-    "∑", "∏", "√", "∞", "∫", "∂", "∆", "∇", "∈", 
-    "∉", "∋", "∅", "∧", "∨", "⊕", "⊗", "⊆", "⊇", 
-    "∝", "∴", "∵", "∃", "∀", "∩", "∪", "≈", "≅",
-    
-    /* Greek Alphabet */
-    "Α", "Β", "Γ", "Δ", "Θ", "Ι", "Λ", "Ξ", "Π", 
-    "Σ", "Φ", "Ψ", "Ω", "α", "β", "γ", "δ", "ε", 
-    "ζ", "η", "θ", "ι", "κ", "λ", "μ", "ν", "ξ", 
-    "ο", "π", "ρ", "σ", "τ", "υ", "φ", "χ", "ψ", "ω",
-    
-    /* Chinese Characters */
-    "你", "好", "我", "是", "天", "地", "人", "山", "水", "火", 
-    "大", "小", "中", "国", "学", "生", "爱", "书", "车", "猫", 
-    "狗", "月", "日", "年", "风", "雨", "花", "草", "树", "家",
-    "鼠", "牛", "虎", "兔", "龙", "蛇", "马", "羊", "猴", "鸡", 
-    "猪", "星", "空", "光", "影", "梦", "夜", "晨", "时", "钟", 
-    "金", "银", "玉", "石", "海", "湖", "江", "河", "山", "川",
-};
-
-#define NUM_UNICODE_CHARS (sizeof(unicode_chars) / sizeof(unicode_chars[0]))
+#include "storm_sim.h"
+#include "storm_pool.h"
+#include "storm_governor.h"
+#include "storm_gpu.h"
+#include "storm_export.h"
+#include "storm_atlas.h"
+#include "storm_power.h"
+#include "storm_profile.h"
 
-/* Pre-rendered textures for Unicode characters */
-SDL_Texture *unicode_textures[NUM_UNICODE_CHARS];
-
-/* Data Structures */
-
-/* Falling column for matrix rain */
-typedef struct {
-    float x;                  /* Horizontal position (head) in pixels */
-    float y;                  /* Vertical position (head) in pixels */
-    float vx;                 /* Horizontal velocity (pixels/s) */
-    float vy;                 /* Vertical velocity (pixels/s) */
-    int length;               /* Number of characters in the column */
-    float depth;              /* Brightness factor (0.0 to 1.0) */
-    int *indices;             /* Array of indices into unicode_chars */
-    float char_update_timer;  /* Timer for character updates */
-} Column;
-
-/* Lightning branch structure */
-typedef struct {
-    SDL_Point *points;
-    int num_points;
-} LightningBranch;
-
-/* Lightning effect representation */
-typedef struct {
-    float timer;              /* Remaining time for the effect */
-    float initial_timer;      /* Initial duration */
-    int effect_type;          /* 0: bolt, 1: full-screen flash */
-    SDL_Point *points;        /* Main bolt points */
-    int num_points;           /* Number of main bolt points */
-
-    /* Precomputed branches (constant during the effect) */
-    LightningBranch *branches;
-    int num_branches;
-} LightningEffect;
+/* Configuration */
+#define FONT_PATH "matrix_font_subset.ttf"
+#define FONT_SIZE 16            /* Keep in sync with storm_bake */
+#define MAX_STEPS_PER_FRAME 8  /* Drop simulation time beyond this many steps per frame */
+#define CATCH_UP_SECONDS 1.0   /* Simulation time made up after a pause; the rest is skipped */
+
+/* Glyph atlas: every Unicode character pre-rendered into a single texture */
+SDL_Texture *glyph_atlas = NULL;
+SDL_FRect glyph_uv[NUM_UNICODE_CHARS];    /* Normalized texture coordinates per glyph */
+bool glyph_valid[NUM_UNICODE_CHARS];      /* False if the glyph failed to render */
+
+/* Trail rendering modes */
+#define TRAILS_CANVAS 0    /* Fade an offscreen canvas every frame and copy it to the screen */
+#define TRAILS_ANALYTIC 1  /* Draw straight to the screen, fading glyph alpha along each column */
+
+/* Analytic trails: alpha lost from the head to the last glyph of a column,
+ * and alpha of the ghost glyph left in the slot the column just vacated */
+#define TRAIL_TAIL_FADE 0.75f
+#define TRAIL_GHOST_ALPHA 0.15f
+
+/* Dynamic resolution: internal canvas sizes relative to the window, from
+ * full resolution down to half */
+#define NUM_CANVAS_SCALES 5
+static const float canvas_scales[NUM_CANVAS_SCALES] = { 1.0f, 0.875f, 0.75f, 0.625f, 0.5f };
+#define SCALE_DOWN_THRESHOLD 1.25  /* Drop a level when frames average this many refresh periods */
+#define SCALE_UP_DELAY 2.0         /* Seconds on budget before trying the next level up */
+#define SCALE_UP_DELAY_MAX 32.0    /* Back-off limit after step-ups that had to be undone */
 
 /* Global Variables */
 
-/* Array of active falling columns */
-Column **columns = NULL;
-size_t num_columns = 0;
-size_t columns_capacity = 0;
-
 /* SDL objects */
 SDL_Window   *window   = NULL;
 SDL_Renderer *renderer = NULL;
-TTF_Font     *font     = NULL;
 SDL_Texture  *canvas   = NULL;  /* Offscreen render target for trail effect */
-
-int char_width, char_height;     /* Character dimensions (monospace) */
-Uint32 last_ticks = 0;
-
-LightningEffect *lightning = NULL;
-
-/* Wind effect variables */
-float current_wind_angle = 0.0f;       /* Current wind angle (degrees) */
-float target_wind_angle = 0.0f;        /* Target wind angle (degrees) */
-float wind_start_angle = 0.0f;         /* Wind angle at transition start */
-float wind_idle_timer = 3.0f;          /* Idle duration before wind change */
-float wind_transition_timer = 0.0f;    /* Timer during wind transition */
-float wind_transition_duration = 0.0f; /* Transition duration */
-bool wind_in_transition = false;       /* Flag: wind is transitioning */
-
-/* Utility Functions */
-
-/* Returns a random index for the unicode_chars array */
-int random_unicode_index(void) {
-    return rand() % NUM_UNICODE_CHARS;
-}
-
-/* Create a new falling column at the given horizontal position */
-Column *create_column(int col_index) {
-    Column *col = malloc(sizeof(Column));
-    if (!col) return NULL;
-    col->x = (float)col_index;
-    col->y = -(rand() % g_screen_height);
-    col->length = 5 + rand() % 23;
-    col->depth = (float)(rand() % 101) / 100.0f;
-    col->char_update_timer = 0.0f;
-    col->indices = malloc(col->length * sizeof(int));
-    if (!col->indices) {
-        free(col);
-        return NULL;
-    }
-    for (int i = 0; i < col->length; i++) {
-        col->indices[i] = random_unicode_index();
-    }
-    /* Initialize vertical speed (50-200 pixels/s); no horizontal speed */
-    col->vy = 50.0f + (float)(rand() % 150);
-    col->vx = 0.0f;
-    return col;
-}
-
-/* Free the memory allocated for a column */
-void destroy_column(Column *col) {
-    if (col) {
-        free(col->indices);
-        free(col);
-    }
-}
-
-/* Initialize pre-rendered textures for Unicode characters */
-void init_unicode_textures(void) {
-    for (int i = 0; i < NUM_UNICODE_CHARS; i++) {
-        SDL_Color white = { 255, 255, 255, 255 };
-        /* Render using blended rendering for anti-aliased text */
-        SDL_Surface *surf = TTF_RenderUTF8_Blended(font, unicode_chars[i], white);
-        if (!surf) {
-            printf("Failed to render '%s': %s\n", unicode_chars[i], TTF_GetError());
-            continue;
-        }
-        unicode_textures[i] = SDL_CreateTextureFromSurface(renderer, surf);
-        SDL_FreeSurface(surf);
+SDL_Texture  *screen_target = NULL;  /* Composited frame for export; NULL = the window */
+bool use_gpu_renderer = false;  /* Draw with storm_gpu instead of SDL_Renderer; renderer stays NULL */
+int trail_mode = TRAILS_CANVAS;  /* How trails are drawn; toggled with T */
+
+/* Dynamic resolution state of the trail canvas */
+bool dynamic_resolution = true;  /* Pick canvas_scale_level from the frame time */
+int canvas_scale_level = 0;      /* Index into canvas_scales */
+double refresh_period = 1.0 / 60.0;  /* Frame time budget in seconds */
+double frame_time_avg = 0.0;     /* Smoothed frame time in seconds */
+double scale_hold_timer = 0.0;   /* Time spent on budget at the current level */
+double scale_up_delay = SCALE_UP_DELAY;
+bool scale_probing = false;      /* The last level change was a step up */
+double idle_seconds = 0.0;       /* Time slept between frames on purpose, not part of the frame cost */
+int raf_interval = 1;            /* Web: display refreshes per frame */
+
+/* Batched glyph geometry, rebuilt every frame and submitted in one draw call */
+SDL_Vertex *glyph_vertices = NULL;
+int *glyph_indices = NULL;
+size_t glyph_quad_capacity = 0;
+size_t num_glyph_quads = 0;
+
+/* Culling results of render_columns(): the last frame and running totals */
+typedef struct {
+    size_t columns_drawn;     /* Columns with at least one glyph in view */
+    size_t columns_culled;    /* Columns skipped without touching their glyphs */
+    size_t glyphs_drawn;
+    size_t glyphs_culled;     /* Glyphs of live columns outside the view */
+} RenderStats;
+RenderStats render_stats;
+RenderStats render_totals;
+unsigned long long frames_rendered = 0;
+
+/* Startup milestones, reported once each by report_startup_time() */
+Uint64 startup_counter = 0;      /* Performance counter when main() started */
+bool full_glyph_set = false;     /* The atlas holds every character, not the fallback set */
+bool first_frame_reported = false;
+bool full_glyphs_reported = false;
+
+/* Profiler overlay (P) and trace (J, --trace) */
+#define HUD_TEXT_HEIGHT 14.0f    /* Pixels */
+#define HUD_REFRESH_FRAMES 15    /* Frames between recomputing the percentiles */
+#define HUD_LINES (PROFILE_NUM_PHASES + 4)
+#define HUD_LINE_CHARS 32
+bool show_profile_hud = false;
+char hud_text[HUD_LINES][HUD_LINE_CHARS + 1];
+int hud_age = HUD_REFRESH_FRAMES;  /* Frames since hud_text was formatted */
+Uint64 hud_print_due = 0;        /* Performance counter of the next console table (GPU renderer) */
+SDL_Vertex hud_vertices[HUD_LINES * HUD_LINE_CHARS * 4];
+int hud_indices[HUD_LINES * HUD_LINE_CHARS * 6];
+const char *trace_path = "storm_trace.json";
+bool trace_on_quit = false;      /* --trace was given */
+unsigned long sim_allocations_seen = 0;  /* sim_allocations at the end of the last frame */
+
+/* Fixed-step simulation clock */
+Uint64 last_counter = 0;         /* Performance counter at the previous frame */
+double sim_accumulator = 0.0;    /* Unsimulated time in seconds */
+unsigned run_seed = 0;           /* Seed of this run, printed for replays */
+float run_density = 0.0f;        /* Column density requested for this run */
+
+#ifndef STORM_NO_TTF
+/* Fallback when no baked atlas is available: rasterize the glyphs now */
+static bool render_glyph_atlas(GlyphAtlas *atlas) {
+    if (TTF_Init() != 0) {
+        printf("TTF_Init Error: %s\n", TTF_GetError());
+        return false;
     }
-    /* Set character dimensions based on the first texture */
-    if (unicode_textures[0]) {
-        SDL_QueryTexture(unicode_textures[0], NULL, NULL, &char_width, &char_height);
+    TTF_Font *font = TTF_OpenFont(FONT_PATH, FONT_SIZE);
+    if (!font) {
+        printf("TTF_OpenFont Error: %s\n", TTF_GetError());
+        TTF_Quit();
+        return false;
     }
+    bool ok = atlas_render(font, atlas);
+    TTF_CloseFont(font);
+    TTF_Quit();
+    return ok;
 }
+#endif
 
-/* 
- * Compute the wind influence factor for a column based on its x position.
- * During a wind transition, a "wave" propagates across the screen:
- *   - If the wind is increasing (target_wind_angle > wind_start_angle), the wind
- *     comes from the left. Columns with x values below the wave front get full effect.
- *   - If the wind is decreasing (target_wind_angle < wind_start_angle), the wind 
- *     comes from the right.
- *
- * The transition zone (over which columns gradually come under wind's influence) is
- * made dynamic based on the magnitude of the change in wind angle.
+/* Make `atlas` the one glyphs are drawn from: fill glyph_uv, glyph_valid and
+ * the cell size, and replace the atlas texture.  Frees `atlas`.  On failure
+ * the previous atlas stays in use, layout included.
  */
-float get_wind_factor(float col_x) {
-    if (!wind_in_transition)
-        return 1.0f;  // if not in transition, all columns receive full effect
-
-    float wave_progress = wind_transition_timer / wind_transition_duration;  // [0,1]
-    float angle_diff = fabs(target_wind_angle - wind_start_angle);
-    // A larger wind change should cause a faster (shorter) transition zone.
-    float zone = 50.0f - (angle_diff * 0.2f);
-    if (zone < 10.0f)
-        zone = 10.0f;
-
-    if (target_wind_angle > wind_start_angle) {
-        // Wind emerges from the left; wave front moves right.
-        float wave_front = wave_progress * g_screen_width;
-        if (col_x <= wave_front) {
-            return 1.0f;
-        } else if (col_x < wave_front + zone) {
-            return 1.0f - ((col_x - wave_front) / zone);
-        } else {
-            return 0.0f;
-        }
+static bool install_glyph_atlas(GlyphAtlas *atlas) {
+    SDL_FRect uv[NUM_UNICODE_CHARS];
+    bool valid[NUM_UNICODE_CHARS];
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++) {
+        const AtlasGlyph *g = &atlas->glyphs[i];
+        valid[i] = g->w > 0;
+        uv[i].x = (float)g->x / atlas->width;
+        uv[i].y = (float)g->y / atlas->height;
+        uv[i].w = (float)g->w / atlas->width;
+        uv[i].h = (float)g->h / atlas->height;
+    }
+    int cell_width = atlas->char_width, cell_height = atlas->char_height;
+    SDL_Surface *surface = atlas_to_surface(atlas);
+    atlas_free(atlas);
+    if (!surface) return false;
+
+    bool ok = true;
+    if (use_gpu_renderer) {
+        ok = gpu_load_atlas(surface, uv, valid, NUM_UNICODE_CHARS);
+        if (!ok) printf("Failed to upload glyph atlas\n");
     } else {
-        // Wind emerges from the right; wave front moves left.
-        float wave_front = g_screen_width - (wave_progress * g_screen_width);
-        if (col_x >= wave_front) {
-            return 1.0f;
-        } else if (col_x > wave_front - zone) {
-            return 1.0f - ((wave_front - col_x) / zone);
+        SDL_Texture *texture = SDL_CreateTextureFromSurface(renderer, surface);
+        if (!texture) {
+            printf("Failed to create glyph atlas: %s\n", SDL_GetError());
+            ok = false;
         } else {
-            return 0.0f;
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            if (glyph_atlas) SDL_DestroyTexture(glyph_atlas);
+            glyph_atlas = texture;
         }
     }
+    SDL_FreeSurface(surface);
+    if (!ok) return false;
+
+    memcpy(glyph_uv, uv, sizeof(uv));
+    memcpy(glyph_valid, valid, sizeof(valid));
+    char_width = cell_width;
+    char_height = cell_height;
+    return true;
+}
+
+/* Report a startup milestone: printed, and on the web also handed to the
+ * page as Module.stormTimings[name] and a "stormtiming" event on window,
+ * in ms of performance.now() so the download and compilation are included.
+ */
+static void report_startup_time(const char *name) {
+    double ms = (double)(SDL_GetPerformanceCounter() - startup_counter) * 1000.0 / SDL_GetPerformanceFrequency();
+#ifdef __EMSCRIPTEN__
+    ms = EM_ASM_DOUBLE({
+        var name = UTF8ToString($0);
+        var now = performance.now();
+        Module.stormTimings = Module.stormTimings || {};
+        Module.stormTimings[name] = now;
+        window.dispatchEvent(new CustomEvent('stormtiming', { detail: { name: name, ms: now } }));
+        return now;
+    }, name);
+#endif
+    printf("Startup: %s at %.1f ms\n", name, ms);
 }
 
-/* Update falling columns: position, velocity, and character content */
-void update_columns(float delta) {
-    size_t write_index = 0;
-    int extended_margin = char_height * 50;  /* Retain columns within extended bounds */
+#ifdef __EMSCRIPTEN__
+/* The baked atlas arrived: swap it in for the fallback set */
+static void on_atlas_fetched(void *arg, void *data, int size) {
+    (void)arg;
+    Uint64 start = SDL_GetPerformanceCounter();
+    GlyphAtlas atlas;
+    /* The atlas refers to the download, which is freed after this returns */
+    if (!atlas_load_memory(data, (size_t)size, BAKED_ATLAS_PATH, &atlas)) return;
+    if (!install_glyph_atlas(&atlas)) return;
+    full_glyph_set = true;
+    printf("Glyph atlas: baked (fetched), %.1f ms\n",
+           (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency());
+}
 
-    // Precompute tan of wind angle to avoid repetitive conversion
-    float wind_angle_rad = current_wind_angle * M_PI / 180.0f;
-    float tan_wind = tanf(wind_angle_rad);
+static void on_atlas_fetch_failed(void *arg) {
+    (void)arg;
+    printf("Cannot fetch %s; keeping the fallback glyphs\n", BAKED_ATLAS_PATH);
+}
+#endif
 
-    for (size_t i = 0; i < num_columns; i++) {
-        Column *col = columns[i];
+/* Load the glyph atlas into a texture and fill glyph_uv and glyph_valid.
+ * The atlas baked by storm_bake is used when present; otherwise (unless
+ * built with STORM_NO_TTF) the glyphs are rendered from the font.  If
+ * neither works the embedded fallback set is used.  On the web the baked
+ * file is not preloaded: the fallback set is up at once so the first frame
+ * does not wait for the download, and the fetched atlas replaces it.
+ */
+bool init_glyph_atlas(void) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    GlyphAtlas atlas;
+    const char *source = "baked";
+    bool loaded = atlas_load(BAKED_ATLAS_PATH, &atlas);
+#ifndef STORM_NO_TTF
+    if (!loaded) {
+        source = "rendered with SDL_ttf";
+        loaded = render_glyph_atlas(&atlas);
+        if (!loaded) atlas_free(&atlas);
+    }
+#endif
+    full_glyph_set = loaded;
+    if (!loaded) {
+        source = "embedded fallback set";
+        if (!atlas_fallback(&atlas)) return false;
+#ifdef __EMSCRIPTEN__
+        source = "embedded fallback set, fetching " BAKED_ATLAS_PATH;
+        emscripten_async_wget_data(BAKED_ATLAS_PATH, NULL, on_atlas_fetched, on_atlas_fetch_failed);
+#endif
+    }
 
-        /* Apply gravity */
-        col->vy += GRAVITY * delta;
-        if (col->vy > TERMINAL_VELOCITY)
-            col->vy = TERMINAL_VELOCITY;
+    bool ok = install_glyph_atlas(&atlas);
+    printf("Glyph atlas: %s, %.1f ms\n", source,
+           (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency());
+    return ok;
+}
 
-        /* Adjust horizontal velocity based on wind, using precomputed tan value */
-        float target_vx = tan_wind * col->vy;
-        float wind_factor = get_wind_factor(col->x);
-        col->vx += (target_vx - col->vx) * WIND_RESPONSE * wind_factor * delta;
+/* Make room for at least `quads` glyph quads in the batch buffers.
+ * The index pattern is static, so it is only written for newly added quads.
+ */
+static bool reserve_glyph_quads(size_t quads) {
+    if (quads <= glyph_quad_capacity)
+        return true;
+    size_t new_capacity = (glyph_quad_capacity == 0) ? 1024 : glyph_quad_capacity;
+    while (new_capacity < quads)
+        new_capacity *= 2;
+
+    SDL_Vertex *new_vertices = realloc(glyph_vertices, new_capacity * 4 * sizeof(SDL_Vertex));
+    if (!new_vertices) return false;
+    glyph_vertices = new_vertices;
+    int *new_indices = realloc(glyph_indices, new_capacity * 6 * sizeof(int));
+    if (!new_indices) return false;
+    glyph_indices = new_indices;
+
+    for (size_t q = glyph_quad_capacity; q < new_capacity; q++) {
+        int base = (int)(q * 4);
+        int *idx = &glyph_indices[q * 6];
+        idx[0] = base;     idx[1] = base + 1; idx[2] = base + 2;
+        idx[3] = base + 2; idx[4] = base + 3; idx[5] = base;
+    }
+    glyph_quad_capacity = new_capacity;
+    return true;
+}
 
-        /* Update position */
-        col->x += col->vx * delta;
-        col->y += col->vy * delta;
+/* Add the culling results of a frame to the run totals */
+static void record_render_stats(size_t glyphs_drawn) {
+    render_stats.columns_drawn = glyph_stream.columns_drawn;
+    render_stats.columns_culled = glyph_stream.columns_culled;
+    render_stats.glyphs_culled = glyph_stream.glyphs_culled;
+    render_stats.glyphs_drawn = glyphs_drawn;
+    render_totals.columns_drawn += render_stats.columns_drawn;
+    render_totals.columns_culled += render_stats.columns_culled;
+    render_totals.glyphs_drawn += render_stats.glyphs_drawn;
+    render_totals.glyphs_culled += render_stats.glyphs_culled;
+    frames_rendered++;
+}
 
-        /* Update characters periodically */
-        col->char_update_timer += delta;
-        if (col->char_update_timer > 0.1f) {
-            for (int j = 0; j < col->length; j++) {
-                if (rand() % 2 == 0)
-                    col->indices[j] = random_unicode_index();
-            }
-            col->char_update_timer = 0.0f;
-        }
+/* Render all falling columns.
+ * Every visible glyph becomes a rotated, depth-scaled quad textured from the
+ * glyph atlas; the whole batch is submitted with a single SDL_RenderGeometry.
+ * Column heads are interpolated between the last two simulation steps by
+ * `alpha` (0 = previous step, 1 = latest step).  In TRAILS_ANALYTIC mode the
+ * glyphs fade out along the column and each column also draws a faint ghost
+ * of its last glyph one slot further up, standing in for the persistence of
+ * the canvas fade.
+ *
+ * The glyphs come from glyph_stream, which update_columns() fills with the
+ * instances in view while it simulates, so this only turns instances into
+ * quads.  The splash fragments that update_particles() writes follow them
+ * in the same batch, as quads showing a quarter of their glyph.
+ */
+void render_columns(float alpha) {
+    if (!glyph_atlas) return;
+    num_glyph_quads = 0;
+
+    size_t total = glyph_stream.count + glyph_stream.fragments;
+    if (!reserve_glyph_quads(total))
+        return;
 
-        /* Compute fall angle and cache sine and cosine values */
-        float fall_angle = atan2(col->vx, col->vy);
-        float sine = sinf(fall_angle);
-        float cosine = cosf(fall_angle);
-        float dx = -char_height * sine;
-        float dy = -char_height * cosine;
-
-        /* Calculate bounding box for the column */
-        float letter0_x = col->x;
-        float letter_end_x = col->x + (col->length - 1) * dx;
-        float min_x = (letter0_x < letter_end_x) ? letter0_x : letter_end_x;
-        float max_x = (letter0_x > letter_end_x) ? letter0_x : letter_end_x;
-
-        float letter0_y = col->y;
-        float letter_end_y = col->y + (col->length - 1) * dy;
-        float min_y = (letter0_y < letter_end_y) ? letter0_y : letter_end_y;
-        float max_y = (letter0_y > letter_end_y) ? letter0_y : letter_end_y;
-
-        /* Retain columns that are within the extended margin */
-        if (max_y >= -extended_margin && min_y <= g_screen_height + extended_margin &&
-            max_x >= -extended_margin && min_x <= g_screen_width + extended_margin) {
-            columns[write_index++] = col;
+    float rewind = 1.0f - alpha;  /* Fraction of the last step to undo */
+    for (size_t i = 0; i < total; i++) {
+        const GlyphInstance *inst = i < glyph_stream.count ? &glyph_stream.instances[i] :
+                                    &glyph_stream.fragment_instances[i - glyph_stream.count];
+        float letterX = inst->x - inst->mx * rewind;
+        float letterY = inst->y - inst->my * rewind;
+        if (letterY < -char_height || letterY > g_screen_height) continue;
+        if (!glyph_valid[inst->glyph]) continue;
+
+        SDL_FRect uv = glyph_uv[inst->glyph];
+        float half_w, half_h, cx, cy;
+        if (inst->flags & GLYPH_FRAGMENT) {
+            /* Splash fragment: one quarter of the glyph, scaled both ways
+             * about its unsnapped center */
+            int quarter = (inst->flags >> GLYPH_QUARTER_SHIFT) & 3;
+            uv.w *= 0.5f;
+            uv.h *= 0.5f;
+            uv.x += (quarter & 1) * uv.w;
+            uv.y += (quarter >> 1) * uv.h;
+            half_w = char_width * 0.25f * inst->scale;
+            half_h = char_height * 0.25f * inst->scale;
+            cx = letterX;
+            cy = letterY;
         } else {
-            destroy_column(col);
+            /* Depth-scaled width, centered in the character cell */
+            float scaled_width = (float)(int)(char_width * inst->scale);
+            float offset = (float)(int)((char_width - scaled_width) / 2);
+            half_w = scaled_width * 0.5f;
+            half_h = char_height * 0.5f;
+            cx = (float)(int)letterX + offset + half_w;
+            cy = (float)(int)letterY + half_h;
         }
+
+        /* Rotated half-extents of the quad; the quad is rotated by -fall_angle about its center */
+        float ux = half_w * inst->cosine, uy = -half_w * inst->sine;  /* Rotated (half_w, 0) */
+        float vx = half_h * inst->sine,   vy = half_h * inst->cosine; /* Rotated (0, half_h) */
+
+        SDL_Vertex *v = &glyph_vertices[num_glyph_quads * 4];
+        v[0].position.x = cx - ux - vx; v[0].position.y = cy - uy - vy;
+        v[0].tex_coord.x = uv.x;        v[0].tex_coord.y = uv.y;
+        v[1].position.x = cx + ux - vx; v[1].position.y = cy + uy - vy;
+        v[1].tex_coord.x = uv.x + uv.w; v[1].tex_coord.y = uv.y;
+        v[2].position.x = cx + ux + vx; v[2].position.y = cy + uy + vy;
+        v[2].tex_coord.x = uv.x + uv.w; v[2].tex_coord.y = uv.y + uv.h;
+        v[3].position.x = cx - ux + vx; v[3].position.y = cy - uy + vy;
+        v[3].tex_coord.x = uv.x;        v[3].tex_coord.y = uv.y + uv.h;
+        v[0].color = v[1].color = v[2].color = v[3].color = inst->color;
+        num_glyph_quads++;
     }
-    num_columns = write_index;
-
-    /* Occasionally spawn a new column over an extended range */
-    int margin = char_height * 50;
-    if ((rand() % 100) < 20) {
-        int col_index = (rand() % (g_screen_width + 2 * margin)) - margin;
-        Column *newcol = create_column(col_index);
-        if (newcol) {
-            if (num_columns >= columns_capacity) {
-                size_t new_capacity = (columns_capacity == 0) ? 16 : columns_capacity * 2;
-                Column **new_columns = realloc(columns, new_capacity * sizeof(Column *));
-                if (new_columns) {
-                    columns = new_columns;
-                    columns_capacity = new_capacity;
-                    columns[num_columns++] = newcol;
-                } else {
-                    destroy_column(newcol);
-                }
-            } else {
-                columns[num_columns++] = newcol;
-            }
+
+    record_render_stats(num_glyph_quads);
+
+    if (num_glyph_quads > 0) {
+        SDL_RenderGeometry(renderer, glyph_atlas, glyph_vertices, (int)(num_glyph_quads * 4),
+                           glyph_indices, (int)(num_glyph_quads * 6));
+        profile_count(PROFILE_DRAW_CALLS, 1);
+    }
+}
+
+/* Print the average culling results of the run */
+void print_render_stats(void) {
+    if (frames_rendered == 0) return;
+    double n = (double)frames_rendered;
+    printf("Columns per frame: %.1f drawn, %.1f culled; glyphs per frame: %.1f drawn, %.1f culled\n",
+           render_totals.columns_drawn / n, render_totals.columns_culled / n,
+           render_totals.glyphs_drawn / n, render_totals.glyphs_culled / n);
+}
+
+/* Print what the run cost: frames, main-thread work and process CPU time */
+void print_power_stats(void) {
+    PowerStatus power;
+    power_status(&power);
+    double active = power.seconds - power.paused_seconds;
+    if (active <= 0.0) return;
+    printf("Power: %llu frames in %.1f s visible (%.1f frames/s), %.1f s paused; main thread busy %.0f ms/s",
+           power.frames, active, power.frames / active, power.paused_seconds,
+           power.busy_seconds * 1000.0 / active);
+    if (power.cpu_seconds >= 0.0)
+        printf(", process CPU %.0f ms/s", power.cpu_seconds * 1000.0 / power.seconds);
+    printf("\n");
+}
+
+/* Publish the last one-second power sample to the page as Module.stormPower */
+static void report_power_sample(void) {
+#ifdef __EMSCRIPTEN__
+    PowerStatus power;
+    power_status(&power);
+    EM_ASM({
+        var power = Module.stormPower = Module.stormPower || {};
+        power.fps = $0;
+        power.busyMs = $1;
+        power.frames = $2;
+        power.pausedSeconds = $3;
+    }, power.sample_fps, power.sample_busy_ms, (double)power.frames, power.paused_seconds);
+#endif
+}
+
+/* Stop simulating and drawing while the window cannot be seen.  On return
+ * up to CATCH_UP_SECONDS of the time missed are simulated in one go, so the
+ * storm has moved on without a burst of rendered frames.
+ */
+void set_paused(bool paused) {
+    if (paused == power_paused()) return;
+    double hidden = power_set_paused(paused);
+    if (paused) {
+        printf("Window hidden: paused\n");
+#ifdef __EMSCRIPTEN__
+        emscripten_pause_main_loop();
+#endif
+        return;
+    }
+    double catch_up = hidden < CATCH_UP_SECONDS ? hidden : CATCH_UP_SECONDS;
+    for (int steps = (int)(catch_up / SIM_STEP); steps > 0; steps--)
+        step_simulation(SIM_STEP);
+    last_counter = SDL_GetPerformanceCounter();
+    printf("Window visible after %.1f s: simulated %.2f s to catch up\n", hidden, catch_up);
+#ifdef __EMSCRIPTEN__
+    emscripten_resume_main_loop();
+#endif
+}
+
+#ifdef __EMSCRIPTEN__
+/* Page Visibility API: the main loop is paused here directly, since a
+ * paused loop polls no SDL events */
+static EM_BOOL on_visibility_change(int type, const EmscriptenVisibilityChangeEvent *event, void *arg) {
+    (void)type;
+    (void)arg;
+    set_paused(event->hidden);
+    return EM_FALSE;
+}
+#endif
+
+/* Print the options that reproduce the simulation state reached so far */
+void print_replay_info(void) {
+    printf("Replay: --seed %u --steps %llu --size %dx%d",
+           run_seed, sim_steps, g_screen_width, g_screen_height);
+    if (lightning_detail > 0)
+        printf(" --lightning-detail %d", lightning_detail);
+    if (lightning_rate != LIGHTNING_RATE_DEFAULT)
+        printf(" --lightning-rate %g", lightning_rate);
+    if (wind_gust_rate != WIND_GUST_RATE_DEFAULT)
+        printf(" --gusts %g", wind_gust_rate);
+    if (splash_fragments != SPLASH_FRAGMENTS_DEFAULT)
+        printf(" --splash %d", splash_fragments);
+    printf(" --density %g", run_density);
+    if (column_cap != COLUMN_CAP_DEFAULT)
+        printf(" --max-columns %d", column_cap);
+    printf("\n");
+
+    GovernorStatus governor;
+    governor_status(&governor);
+    if (governor.num_decisions > 0) {
+        printf("Note: the load governor changed tiers %d times during this run; "
+               "a replay with --governor off diverges from it.\n", governor.num_decisions);
+    }
+}
+
+/* (Re)create the trail canvas at the current screen size and resolution
+ * scale.  Existing trails are resampled into the new canvas so a change of
+ * scale does not blank the screen.
+ */
+bool create_canvas(void) {
+    if (use_gpu_renderer) return true;  /* storm_gpu sizes its canvas to match every frame */
+    float scale = canvas_scales[canvas_scale_level];
+    int w = (int)(g_screen_width * scale + 0.5f);
+    int h = (int)(g_screen_height * scale + 0.5f);
+    if (w < 1) w = 1;
+    if (h < 1) h = 1;
+    SDL_Texture *old = canvas;
+    canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, w, h);
+    if (!canvas) {
+        printf("SDL_CreateTexture Error: %s\n", SDL_GetError());
+        if (old) SDL_DestroyTexture(old);
+        return false;
+    }
+    SDL_SetRenderTarget(renderer, canvas);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+    SDL_RenderClear(renderer);
+    if (old) {
+        SDL_RenderCopy(renderer, old, NULL, NULL);
+        SDL_DestroyTexture(old);
+    }
+    SDL_SetRenderTarget(renderer, NULL);
+    return true;
+}
+
+/* Adjust the canvas resolution to the measured frame time.  Frames that
+ * consistently overrun the refresh period drop one level at once; after
+ * SCALE_UP_DELAY seconds on budget the next level up is tried, and if that
+ * has to be undone the wait before the next attempt doubles.
+ */
+void update_canvas_scale(double frame_seconds) {
+    if (!dynamic_resolution || trail_mode != TRAILS_CANVAS) return;
+    if (frame_seconds > 0.25) return;  /* Stalls (window drags, breakpoints) say nothing about load */
+    frame_time_avg = frame_time_avg > 0.0 ? frame_time_avg * 0.9 + frame_seconds * 0.1 : frame_seconds;
+
+    int level = canvas_scale_level;
+    if (frame_time_avg > refresh_period * SCALE_DOWN_THRESHOLD) {
+        if (level + 1 < NUM_CANVAS_SCALES) {
+            level++;
+            if (scale_probing && scale_up_delay < SCALE_UP_DELAY_MAX)
+                scale_up_delay *= 2.0;
+        }
+        scale_hold_timer = 0.0;
+        scale_probing = false;
+    } else {
+        scale_hold_timer += frame_seconds;
+        if (scale_hold_timer >= scale_up_delay) {
+            if (scale_probing)
+                scale_up_delay = SCALE_UP_DELAY;  /* The last step up held */
+            scale_probing = level > 0;
+            if (level > 0) level--;
+            scale_hold_timer = 0.0;
         }
     }
+    if (level == canvas_scale_level) return;
+
+    int previous = canvas_scale_level;
+    canvas_scale_level = level;
+    if (!create_canvas()) {
+        canvas_scale_level = previous;
+        if (!create_canvas()) exit(1);
+        return;
+    }
+    frame_time_avg = refresh_period;  /* Judge the new level on its own frames */
+    printf("Canvas resolution: %d%%\n", (int)(canvas_scales[level] * 100.0f + 0.5f));
 }
 
-/* Render all falling columns */
-void render_columns(void) {
-    for (int i = 0; i < num_columns; i++) {
-        Column *col = columns[i];
-        
-        /* Calculate scale and horizontal offset based on depth */
-        float scale = 0.5f + 0.5f * col->depth;
-        int scaled_width = (int)(char_width * scale);
-        int offset = (char_width - scaled_width) / 2;
-        
-        /* Determine fall rotation angle */
-        float fall_angle = atan2(col->vx, col->vy);
-        float angle_deg = -fall_angle * 180.0f / M_PI;
-        
-        /* Calculate displacement between successive characters */
-        float dx = -char_height * sin(fall_angle);
-        float dy = -char_height * cos(fall_angle);
-        
-        for (int j = 0; j < col->length; j++) {
-            float letterX = col->x + j * dx;
-            float letterY = col->y + j * dy;
-            if (letterY < -char_height || letterY > g_screen_height) continue;
-            
-            int index = col->indices[j];
-            SDL_Texture *tex = unicode_textures[index];
-            if (!tex) continue;
-            
-            SDL_Color color;
-            if (j == 0) {
-                /* Head of column: white */
-                color = (SDL_Color){255, 255, 255, 255};
-            } else {
-                /* Tail: green varying by depth */
-                int brightness = (int)(col->depth * 200) + 55;
-                if (brightness > 255) brightness = 255;
-                color = (SDL_Color){0, brightness, 0, 255};
-            }
-            SDL_SetTextureColorMod(tex, color.r, color.g, color.b);
-            
-            SDL_Rect dst = { (int)letterX + offset, (int)letterY, scaled_width, char_height };
-            SDL_Point center = { dst.w / 2, dst.h / 2 };
-            
-            SDL_RenderCopyEx(renderer, tex, NULL, &dst, angle_deg, &center, SDL_FLIP_NONE);
+/* Have the simulation emit glyph alpha for the current trail mode; the
+ * change shows from the next simulation step on */
+void apply_trail_style(void) {
+    glyph_tail_fade = trail_mode == TRAILS_ANALYTIC ? TRAIL_TAIL_FADE : 0.0f;
+    glyph_ghost_alpha = trail_mode == TRAILS_ANALYTIC ? TRAIL_GHOST_ALPHA : 0.0f;
+}
+
+/* Switch trail rendering mode; the canvas only exists in TRAILS_CANVAS mode */
+void set_trail_mode(int mode) {
+    if (mode == TRAILS_CANVAS) {
+        if (!canvas && !create_canvas()) {
+            mode = TRAILS_ANALYTIC;  /* Keep running without trails rather than exit */
         }
+    } else if (canvas) {
+        SDL_DestroyTexture(canvas);
+        canvas = NULL;
+    }
+    trail_mode = mode;
+    apply_trail_style();
+    printf("Trails: %s\n", trail_mode == TRAILS_CANVAS ? "canvas" : "analytic");
+}
+
+/* Write the profiler's trace to trace_path */
+void write_profile_trace(void) {
+#ifndef __EMSCRIPTEN__
+    FILE *f = fopen(trace_path, "w");
+    if (!f) {
+        printf("Cannot create %s\n", trace_path);
+        return;
     }
+    bool ok = profile_write_trace(f);
+    if (fclose(f) != 0) ok = false;
+    printf(ok ? "Profile trace written to %s\n" : "Failed to write %s\n", trace_path);
+#endif
 }
 
-/* Handle SDL events (quit and window resize) */
+/* Handle SDL events (quit, window resize and the trail mode toggle) */
 void handle_events(void) {
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
         if (event.type == SDL_QUIT) {
+            print_render_stats();
+            print_power_stats();
+            print_replay_info();
+            if (trace_on_quit) write_profile_trace();
 #ifdef __EMSCRIPTEN__
             emscripten_cancel_main_loop();
 #else
@@ -413,487 +606,525 @@ void handle_events(void) {
                 event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
                 SDL_GetWindowSize(window, &g_screen_width, &g_screen_height);
                 printf("Window resized to: %dx%d\n", g_screen_width, g_screen_height);
-                if (canvas) {
-                    SDL_DestroyTexture(canvas);
+                if (!reserve_lightning()) {
+                    printf("Failed to grow the lightning pool; bolts stay coarser\n");
                 }
-                canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
-                                             g_screen_width, g_screen_height);
-                if (!canvas) {
-                    printf("SDL_CreateTexture Error: %s\n", SDL_GetError());
+                if (trail_mode == TRAILS_CANVAS && !create_canvas()) {
                     exit(1);
                 }
-                SDL_SetRenderTarget(renderer, canvas);
-                SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-                SDL_RenderClear(renderer);
-                SDL_SetRenderTarget(renderer, NULL);
+            }
+            if (event.window.event == SDL_WINDOWEVENT_HIDDEN ||
+                event.window.event == SDL_WINDOWEVENT_MINIMIZED) {
+                set_paused(true);
+            } else if (event.window.event == SDL_WINDOWEVENT_SHOWN ||
+                       event.window.event == SDL_WINDOWEVENT_RESTORED) {
+                set_paused(false);
             }
         }
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_t) {
+            set_trail_mode(trail_mode == TRAILS_CANVAS ? TRAILS_ANALYTIC : TRAILS_CANVAS);
+        }
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_p) {
+            show_profile_hud = !show_profile_hud;
+            hud_age = HUD_REFRESH_FRAMES;
+            hud_print_due = 0;
+        }
+        if (event.type == SDL_KEYDOWN && event.key.keysym.sym == SDLK_j) {
+            write_profile_trace();
+        }
     }
 }
 
-/* Lightning Effect Functions */
-
-/* Helper function: recursively perform midpoint displacement.
- * pts: preallocated array of SDL_Point with indices [start, end]
- * start, end: indices in pts representing the segment endpoints
- * depth: remaining recursion depth (each level halves the displacement)
- * displacement: current displacement magnitude
+/*
+ * Draw all live lightning: the glow, core and branch strips of each bolt
+ * were built once when the bolt spawned, so each frame only updates the
+ * fades and submits every bolt in one call.  Flashes share one fill.
  */
-static void midpoint_displacement(SDL_Point* pts, int start, int end, int depth, float displacement) {
-    if (depth <= 0 || end - start < 2)
-        return;
-
-    int mid = (start + end) / 2;
-    SDL_Point A = pts[start];
-    SDL_Point B = pts[end];
-
-    float midX = (A.x + B.x) / 2.0f;
-    float midY = (A.y + B.y) / 2.0f;
-
-    float dx = (float)(B.x - A.x);
-    float dy = (float)(B.y - A.y);
-    float norm = sqrtf(dx * dx + dy * dy);
-    float perpX = 0.0f, perpY = 0.0f;
-    if (norm != 0) {
-        perpX = -dy / norm;
-        perpY = dx / norm;
+void draw_lightning(void) {
+    int num_indices = batch_lightning();
+    if (num_indices > 0) {
+        SDL_RenderGeometry(renderer, NULL, lightning.vertices, LIGHTNING_SLOTS * lightning.slot_vertices,
+                           lightning.batch, num_indices);
+        profile_count(PROFILE_DRAW_CALLS, 1);
     }
-
-    float effective_range = displacement;
-    if (fabsf((float)(B.x - A.x)) > 0.001f && fabsf(perpX) > 1e-6f) {
-        float max_allowed = (fabsf((float)(B.x - A.x)) / 2.0f) / fabsf(perpX);
-        effective_range = fmin(displacement, max_allowed);
+    float flash = lightning_flash_alpha();
+    if (flash > 0.0f) {
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 255, 255, 255, (Uint8)(255 * flash));
+        SDL_RenderFillRect(renderer, NULL);
+        profile_count(PROFILE_DRAW_CALLS, 1);
     }
-    float random_offset = ((float)rand() / (float)RAND_MAX) * 2.0f * effective_range - effective_range;
-    midX += perpX * random_offset;
-    midY += perpY * random_offset;
-
-    if (midY < A.y + 1) midY = A.y + 1;
-    if (midY > B.y - 1) midY = B.y - 1;
-
-    pts[mid].x = (int)midX;
-    pts[mid].y = (int)midY;
-
-    midpoint_displacement(pts, start, mid, depth - 1, displacement / 2.0f);
-    midpoint_displacement(pts, mid, end, depth - 1, displacement / 2.0f);
 }
 
-/* Optimized generate_fractal_lightning_points: preallocate the final array size
- * and fill it recursively.
- *
- * Parameters:
- *   startX, startY - starting coordinates for the lightning bolt
- *   endX, endY     - ending coordinates for the lightning bolt
- *   displacement - initial displacement magnitude
- *   detail       - recursion depth (determines final point count: 2^detail + 1)
- *   num_points   - output parameter; final number of points generated
- *
- * Returns:
- *   Array of SDL_Point with the generated lightning bolt,
- *   or NULL on allocation failure.
+/* Advance the simulation by `seconds` in fixed steps, so behavior and load
+ * do not depend on the display refresh rate.  Returns the interpolation
+ * factor between the last two steps.
  */
-SDL_Point* generate_fractal_lightning_points(int startX, int startY, int endX, int endY,
-                                               float displacement, int detail, int *num_points) {
-    /* Final count is (2^detail) + 1 */
-    int final_count = (1 << detail) + 1;
-    SDL_Point *points = malloc(final_count * sizeof(SDL_Point));
-    if (!points)
-        return NULL;
-
-    points[0].x = startX;
-    points[0].y = startY;
-    points[final_count - 1].x = endX;
-    points[final_count - 1].y = endY;
-
-    midpoint_displacement(points, 0, final_count - 1, detail, displacement);
-
-    *num_points = final_count;
-    return points;
-}
-
-/* Create a new lightning effect */
-LightningEffect* generate_lightning() {
-    LightningEffect* l = malloc(sizeof(LightningEffect));
-    if (!l) return NULL;
-
-    // Decide effect type: 50% chance for full-screen flash (type 1) otherwise bolt (type 0)
-    if (rand() & 1) {
-        l->effect_type = 1;
-        l->timer = 0.5f;
-        l->initial_timer = 0.5f;
-        l->points = NULL;
-        l->num_points = 0;
-        l->branches = NULL;
-        l->num_branches = 0;
-    } else {
-        l->effect_type = 0;
-        l->timer = 1.5f;
-        l->initial_timer = 1.5f;
-        int startX = rand() % g_screen_width;
-        int startY = 0;
-        int endX = rand() % g_screen_width;
-        int endY = (g_screen_height * (70 + (rand() % 31))) / 100;
-        float initial_displacement = g_screen_width / 8.0f;
-        int detail = 6;  // Recursion depth; final point count = (1 << detail) + 1
-        l->points = generate_fractal_lightning_points(startX, startY, endX, endY,
-                                                      initial_displacement, detail, &l->num_points);
-        // Process branches only if a valid bolt is generated.
-        if (l->points && l->num_points > 1) {
-            int num_candidates = l->num_points - 1;
-            int candidate_count = 0;
-            int *candidates = malloc(num_candidates * sizeof(int));
-            if (!candidates) {
-                l->branches = NULL;
-                l->num_branches = 0;
-            } else {
-                // First pass: determine which segments will spawn a branch (25% chance)
-                for (int i = 0; i < num_candidates; i++) {
-                    candidates[i] = (rand() % 100 < 25) ? 1 : 0;
-                    candidate_count += candidates[i];
-                }
-                // Allocate exactly the number needed
-                l->branches = candidate_count > 0 ? malloc(candidate_count * sizeof(LightningBranch)) : NULL;
-                l->num_branches = 0;
-                // Second pass: actually generate the branches for qualifying segments
-                for (int i = 0; i < num_candidates; i++) {
-                    if (candidates[i]) {
-                        SDL_Point start = l->points[i];
-                        float branch_angle = 1.5708f - 0.7854f + ((float)rand() / (float)RAND_MAX) * (0.7854f * 2);
-                        int branch_length = 50 + (rand() % 51);  /* 50 to 100 pixels */
-                        int branch_endX = start.x + (int)(branch_length * cosf(branch_angle));
-                        int branch_endY = start.y + (int)(branch_length * sinf(branch_angle));
-                        if (branch_endX < 0) branch_endX = 0;
-                        if (branch_endX >= g_screen_width) branch_endX = g_screen_width - 1;
-                        if (branch_endY < start.y + 1) branch_endY = start.y + 1;
-                        if (branch_endY >= g_screen_height) branch_endY = g_screen_height - 1;
-                        int branch_num_points = 0;
-                        SDL_Point *branch_points = generate_fractal_lightning_points(start.x, start.y,
-                                                                                     branch_endX, branch_endY,
-                                                                                     initial_displacement / 2.0f, 3, &branch_num_points);
-                        if (branch_points && branch_num_points >= 2) {
-                            l->branches[l->num_branches].points = branch_points;
-                            l->branches[l->num_branches].num_points = branch_num_points;
-                            l->num_branches++;
-                        } else if (branch_points) {
-                            free(branch_points);
-                        }
-                    }
-                }
-                free(candidates);
-            }
-        } else {
-            l->branches = NULL;
-            l->num_branches = 0;
+float advance_simulation(double seconds) {
+    sim_accumulator += seconds;
+    int steps = 0;
+    while (sim_accumulator >= SIM_STEP) {
+        if (steps == MAX_STEPS_PER_FRAME) {
+            sim_accumulator = 0.0;  /* Too far behind; slow down instead of spiraling */
+            break;
         }
+        step_simulation(SIM_STEP);
+        sim_accumulator -= SIM_STEP;
+        steps++;
     }
-    return l;
+    return (float)(sim_accumulator / SIM_STEP);
 }
 
-/*
- * New helper function: draw_smooth_lightning_bolt
- *
- * This version computes a varying thickness along the bolt: the thickness is
- * highest in the center (at progress = 0.5) and tapers down to a specified minimum
- * at the ends (progress = 0 and 1).
- */
-void draw_smooth_lightning_bolt(LightningEffect *l, int max_thickness, SDL_Color color) {
-    int n = l->num_points;
-    if (n < 2) return;
-    int vertex_count = n * 2;
-    int indices_count = (vertex_count - 2) * 3;
-
-    // Use stack allocation if the vertex count is small; fallback to dynamic allocation otherwise.
-    if (vertex_count <= 256) {
-        SDL_Vertex vertices[vertex_count];
-        int indices[indices_count];
-        const float min_thickness = 1.0f;  // Minimum thickness at the bolt's edges
-
-        for (int i = 0; i < n; i++) {
-            SDL_Point p = l->points[i];
-            float progress = (float)i / (n - 1);
-            float local_thickness = min_thickness + (max_thickness - min_thickness) * (1.0f - fabsf(2.0f * progress - 1.0f));
-
-            float tangent_x, tangent_y;
-            if (i == 0) {
-                tangent_x = l->points[i+1].x - p.x;
-                tangent_y = l->points[i+1].y - p.y;
-            } else if (i == n - 1) {
-                tangent_x = p.x - l->points[i-1].x;
-                tangent_y = p.y - l->points[i-1].y;
-            } else {
-                tangent_x = l->points[i+1].x - l->points[i-1].x;
-                tangent_y = l->points[i+1].y - l->points[i-1].y;
-            }
-            float len = sqrtf(tangent_x * tangent_x + tangent_y * tangent_y);
-            if (len == 0) { tangent_x = 1.0f; tangent_y = 0.0f; len = 1.0f; }
-            tangent_x /= len;
-            tangent_y /= len;
-
-            float normal_x = -tangent_y;
-            float normal_y = tangent_x;
-
-            vertices[2 * i].position.x = p.x + normal_x * local_thickness;
-            vertices[2 * i].position.y = p.y + normal_y * local_thickness;
-            vertices[2 * i].color = color;
-
-            vertices[2 * i + 1].position.x = p.x - normal_x * local_thickness;
-            vertices[2 * i + 1].position.y = p.y - normal_y * local_thickness;
-            vertices[2 * i + 1].color = color;
-        }
-
-        int idx = 0;
-        for (int i = 0; i < vertex_count - 2; i++) {
-            if (i % 2 == 0) {
-                indices[idx++] = i;
-                indices[idx++] = i + 1;
-                indices[idx++] = i + 2;
-            } else {
-                indices[idx++] = i + 1;
-                indices[idx++] = i;
-                indices[idx++] = i + 2;
-            }
-        }
-
-        SDL_RenderGeometry(renderer, NULL, vertices, vertex_count, indices, indices_count);
+/* Draw the scene without presenting it; the SDL path composites into
+ * screen_target, the window unless a frame export is running */
+void render_scene(float alpha) {
+    if (use_gpu_renderer) {
+        /* The vertex shader culls instances that interpolate out of view, so
+         * every instance counts as drawn */
+        record_render_stats(glyph_stream.count + glyph_stream.fragments);
+        GpuFrame frame = { alpha, trail_mode == TRAILS_CANVAS, canvas_scales[canvas_scale_level] };
+        gpu_render_frame(&frame);
+        return;
+    }
+    
+    Uint64 t = profile_begin();
+    if (trail_mode == TRAILS_CANVAS) {
+        /* Draw in window coordinates; the scale maps them onto the smaller canvas */
+        SDL_SetRenderTarget(renderer, canvas);
+        float scale = canvas_scales[canvas_scale_level];
+        SDL_RenderSetScale(renderer, scale, scale);
+        /* Apply fade effect for trail */
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
+        SDL_RenderFillRect(renderer, NULL);
+        profile_count(PROFILE_DRAW_CALLS, 1);
+        t = profile_end(PROFILE_FADE, t);
+
+        render_columns(alpha);
+        t = profile_end(PROFILE_GLYPHS, t);
+
+        /* Leaving the target restores the window's scale; the copy upscales the canvas */
+        SDL_SetRenderTarget(renderer, screen_target);
+        SDL_RenderCopy(renderer, canvas, NULL, NULL);
+        profile_count(PROFILE_DRAW_CALLS, 1);
+        profile_end(PROFILE_CANVAS_COPY, t);
     } else {
-        SDL_Vertex *vertices = malloc(vertex_count * sizeof(SDL_Vertex));
-        if (!vertices) return;
-        int *indices = malloc(indices_count * sizeof(int));
-        if (!indices) { free(vertices); return; }
-
-        const float min_thickness = 1.0f;
-        for (int i = 0; i < n; i++) {
-            SDL_Point p = l->points[i];
-            float progress = (float)i / (n - 1);
-            float local_thickness = min_thickness + (max_thickness - min_thickness) * (1.0f - fabsf(2.0f * progress - 1.0f));
-
-            float tangent_x, tangent_y;
-            if (i == 0) {
-                tangent_x = l->points[i+1].x - p.x;
-                tangent_y = l->points[i+1].y - p.y;
-            } else if (i == n - 1) {
-                tangent_x = p.x - l->points[i-1].x;
-                tangent_y = p.y - l->points[i-1].y;
-            } else {
-                tangent_x = l->points[i+1].x - l->points[i-1].x;
-                tangent_y = l->points[i+1].y - l->points[i-1].y;
-            }
-            float len = sqrtf(tangent_x * tangent_x + tangent_y * tangent_y);
-            if (len == 0) { tangent_x = 1.0f; tangent_y = 0.0f; len = 1.0f; }
-            tangent_x /= len;
-            tangent_y /= len;
-
-            float normal_x = -tangent_y;
-            float normal_y = tangent_x;
-
-            vertices[2 * i].position.x = p.x + normal_x * local_thickness;
-            vertices[2 * i].position.y = p.y + normal_y * local_thickness;
-            vertices[2 * i].color = color;
+        /* Trails are part of the glyph alpha; a plain clear is all the screen needs */
+        SDL_SetRenderTarget(renderer, screen_target);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderClear(renderer);
+        t = profile_end(PROFILE_FADE, t);
+        render_columns(alpha);
+        profile_end(PROFILE_GLYPHS, t);
+    }
+    
+    /* Draw lightning effects */
+    if (lightning.count > 0) {
+        t = profile_begin();
+        draw_lightning();
+        profile_end(PROFILE_DRAW_LIGHTNING, t);
+    }
+}
 
-            vertices[2 * i + 1].position.x = p.x - normal_x * local_thickness;
-            vertices[2 * i + 1].position.y = p.y - normal_y * local_thickness;
-            vertices[2 * i + 1].color = color;
-        }
+/* Fill hud_text from the profiler: p50 and p99 of each phase in
+ * microseconds, then the counters of the last frame */
+static void format_profile_hud(void) {
+    ProfileStats stats;
+    profile_stats(&stats);
+    snprintf(hud_text[0], sizeof(hud_text[0]), "%-16s%8s%8s", "phase us", "p50", "p99");
+    for (int p = 0; p < PROFILE_NUM_PHASES; p++) {
+        snprintf(hud_text[1 + p], sizeof(hud_text[0]), "%-16s%8d%8d", profile_phase_names[p],
+                 (int)(stats.p50_ms[p] * 1000.0f + 0.5f), (int)(stats.p99_ms[p] * 1000.0f + 0.5f));
+    }
+    snprintf(hud_text[HUD_LINES - 3], sizeof(hud_text[0]), "columns %lld glyphs %lld",
+             stats.counters[PROFILE_LIVE_COLUMNS], stats.counters[PROFILE_GLYPHS_DRAWN]);
+    snprintf(hud_text[HUD_LINES - 2], sizeof(hud_text[0]), "particles %lld",
+             stats.counters[PROFILE_LIVE_PARTICLES]);
+    snprintf(hud_text[HUD_LINES - 1], sizeof(hud_text[0]), "draws %lld sim allocs %lld",
+             stats.counters[PROFILE_DRAW_CALLS], stats.counters[PROFILE_SIM_ALLOCATIONS]);
+}
 
-        int idx = 0;
-        for (int i = 0; i < vertex_count - 2; i++) {
-            if (i % 2 == 0) {
-                indices[idx++] = i;
-                indices[idx++] = i + 1;
-                indices[idx++] = i + 2;
-            } else {
-                indices[idx++] = i + 1;
-                indices[idx++] = i;
-                indices[idx++] = i + 2;
-            }
+/* Glyph of a HUD character: digits and Latin letters are single-character
+ * entries of unicode_chars[], in the full and the fallback atlas alike.
+ * -1 for anything else, which is left blank. */
+static int hud_glyph(char c) {
+    static int map[128];
+    static bool mapped = false;
+    if (!mapped) {
+        for (int i = 0; i < 128; i++) map[i] = -1;
+        for (int i = 0; i < NUM_UNICODE_CHARS; i++) {
+            const char *u = unicode_chars[i];
+            if (u[0] > 0 && u[1] == '\0' && map[(int)u[0]] < 0 &&
+                ((u[0] >= '0' && u[0] <= '9') || (u[0] >= 'A' && u[0] <= 'Z') || (u[0] >= 'a' && u[0] <= 'z')))
+                map[(int)u[0]] = i;
         }
-        
-        SDL_RenderGeometry(renderer, NULL, vertices, vertex_count, indices, indices_count);
-        free(vertices);
-        free(indices);
+        mapped = true;
     }
+    return c > 0 ? map[(int)c] : -1;
 }
 
-/*
- * Updated draw_lightning function: renders both the main bolt and its branches
- * using a smooth filled polygon with tapered thickness.
+/* Draw hud_text over the top-left corner of the window: one translucent
+ * panel and one batch of glyph quads.  The GPU renderer has no overlay and
+ * prints the same table once a second instead.
  */
-void draw_lightning(LightningEffect *l) {
-    /* Compute fade alpha */
-    float alpha_factor = l->timer / l->initial_timer;
-    Uint8 alpha = (Uint8)(255 * alpha_factor);
-    SDL_Color white = { 255, 255, 255, alpha };
-    SDL_Color glowColor = white;
-    glowColor.a = (Uint8)(alpha * 0.5f); // glow with reduced alpha
-
-    int base_thickness = 3;  /* Maximum thickness at the center of the bolt */
-
-    /* Draw a smooth glowing bolt:
-     * First, draw an outer glow (using a higher max thickness),
-     * then draw the main bolt on top.
-     */
-    draw_smooth_lightning_bolt(l, base_thickness + 4, glowColor);
-    draw_smooth_lightning_bolt(l, base_thickness, white);
-
-    /* Draw branches with a similar tapering effect */
-    for (int i = 0; i < l->num_branches; i++) {
-        LightningBranch branch = l->branches[i];
-        int n = branch.num_points;
-        if (n < 2)
-            continue;
-
-        int vertex_count = n * 2;
-        SDL_Vertex *vertices = malloc(vertex_count * sizeof(SDL_Vertex));
-        if (!vertices)
-            continue;
-
-        float min_thickness = 1.0f;  // minimum thickness at branch ends
-        for (int j = 0; j < n; j++) {
-            SDL_Point p = branch.points[j];
-            float progress = (float)j / (n - 1);
-            float local_thickness = min_thickness + (base_thickness - min_thickness) * (1.0f - fabs(2.0f * progress - 1.0f));
-
-            float tangent_x, tangent_y;
-            if (j == 0) {
-                tangent_x = branch.points[j+1].x - p.x;
-                tangent_y = branch.points[j+1].y - p.y;
-            } else if (j == n - 1) {
-                tangent_x = p.x - branch.points[j-1].x;
-                tangent_y = p.y - branch.points[j-1].y;
-            } else {
-                tangent_x = branch.points[j+1].x - branch.points[j-1].x;
-                tangent_y = branch.points[j+1].y - branch.points[j-1].y;
-            }
-            float len = sqrtf(tangent_x * tangent_x + tangent_y * tangent_y);
-            if (len == 0) { tangent_x = 1; tangent_y = 0; len = 1; }
-            tangent_x /= len;
-            tangent_y /= len;
-            float normal_x = -tangent_y;
-            float normal_y = tangent_x;
-
-            vertices[2*j].position.x     = p.x + normal_x * local_thickness;
-            vertices[2*j].position.y     = p.y + normal_y * local_thickness;
-            vertices[2*j].color          = white;
-            vertices[2*j+1].position.x   = p.x - normal_x * local_thickness;
-            vertices[2*j+1].position.y   = p.y - normal_y * local_thickness;
-            vertices[2*j+1].color        = white;
+void draw_profile_hud(void) {
+    if (hud_age++ >= HUD_REFRESH_FRAMES) {
+        format_profile_hud();
+        hud_age = 0;
+    }
+    if (use_gpu_renderer) {
+        Uint64 now = SDL_GetPerformanceCounter();
+        if (now >= hud_print_due) {
+            format_profile_hud();
+            for (int line = 0; line < HUD_LINES; line++) printf("%s\n", hud_text[line]);
+            hud_print_due = now + SDL_GetPerformanceFrequency();
         }
-        int num_triangles = vertex_count - 2;
-        int indices_count = num_triangles * 3;
-        int *indices = malloc(indices_count * sizeof(int));
-        if (indices) {
-            int idx = 0;
-            for (int j = 0; j < vertex_count - 2; j++) {
-                if(j % 2 == 0) {
-                    indices[idx++] = j;
-                    indices[idx++] = j + 1;
-                    indices[idx++] = j + 2;
-                } else {
-                    indices[idx++] = j + 1;
-                    indices[idx++] = j;
-                    indices[idx++] = j + 2;
-                }
-            }
-            SDL_RenderGeometry(renderer, NULL, vertices, vertex_count, indices, indices_count);
-            free(indices);
+    }
+    if (use_gpu_renderer || !glyph_atlas || hud_glyph('0') < 0) return;
+
+    /* Cell width from the aspect of a digit, so the real font is not stretched */
+    int tex_w, tex_h;
+    SDL_QueryTexture(glyph_atlas, NULL, NULL, &tex_w, &tex_h);
+    SDL_FRect digit = glyph_uv[hud_glyph('0')];
+    float cell_h = HUD_TEXT_HEIGHT;
+    float cell_w = floorf(cell_h * (digit.w * tex_w) / (digit.h * tex_h) + 0.5f);
+    float left = 8.0f, top = 8.0f;
+
+    SDL_FRect panel = { left, top, cell_w * HUD_LINE_CHARS + 16.0f, cell_h * HUD_LINES + 16.0f };
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 190);
+    SDL_RenderFillRectF(renderer, &panel);
+
+    SDL_Color color = { 180, 255, 180, 255 };
+    int quads = 0;
+    for (int line = 0; line < HUD_LINES; line++) {
+        for (int col = 0; hud_text[line][col]; col++) {
+            int g = hud_glyph(hud_text[line][col]);
+            if (g < 0 || !glyph_valid[g]) continue;
+            SDL_FRect uv = glyph_uv[g];
+            float x = left + 8.0f + col * cell_w, y = top + 8.0f + line * cell_h;
+            SDL_Vertex *v = &hud_vertices[quads * 4];
+            v[0].position = (SDL_FPoint){ x, y };
+            v[1].position = (SDL_FPoint){ x + cell_w, y };
+            v[2].position = (SDL_FPoint){ x + cell_w, y + cell_h };
+            v[3].position = (SDL_FPoint){ x, y + cell_h };
+            v[0].tex_coord = (SDL_FPoint){ uv.x, uv.y };
+            v[1].tex_coord = (SDL_FPoint){ uv.x + uv.w, uv.y };
+            v[2].tex_coord = (SDL_FPoint){ uv.x + uv.w, uv.y + uv.h };
+            v[3].tex_coord = (SDL_FPoint){ uv.x, uv.y + uv.h };
+            v[0].color = v[1].color = v[2].color = v[3].color = color;
+            int *idx = &hud_indices[quads * 6];
+            idx[0] = quads * 4;     idx[1] = quads * 4 + 1; idx[2] = quads * 4 + 2;
+            idx[3] = quads * 4 + 2; idx[4] = quads * 4 + 3; idx[5] = quads * 4;
+            quads++;
         }
-        free(vertices);
     }
+    SDL_RenderGeometry(renderer, glyph_atlas, hud_vertices, quads * 4, hud_indices, quads * 6);
+    profile_count(PROFILE_DRAW_CALLS, 2);
+}
+
+#ifdef __EMSCRIPTEN__
+/* Profiler access for the page, e.g. JSON.parse(Module.ccall('storm_profile_stats', 'string')) */
+EMSCRIPTEN_KEEPALIVE const char *storm_profile_stats(void) {
+    return profile_stats_json();
 }
 
+/* The whole trace as Chrome trace event JSON, valid until the next call */
+EMSCRIPTEN_KEEPALIVE const char *storm_profile_trace(void) {
+    static char *trace = NULL;
+    size_t size;
+    free(trace);
+    trace = NULL;
+    FILE *f = open_memstream(&trace, &size);
+    if (!f) return "";
+    profile_write_trace(f);
+    fclose(f);
+    return trace ? trace : "";
+}
+#endif
+
 /* Main loop: handle events, update simulation, and render scene */
 void main_loop(void *arg) {
+    Uint64 frame_profile = profile_begin();
     handle_events();
-    Uint32 current_ticks = SDL_GetTicks();
-    float delta = (current_ticks - last_ticks) / 1000.0f;
-    last_ticks = current_ticks;
+    profile_end(PROFILE_EVENTS, frame_profile);
+    if (power_paused()) return;
+#ifdef __EMSCRIPTEN__
+    if (raf_interval > 1 && !first_frame_reported) {
+        /* The browser paces the loop: only run on every raf_interval-th display refresh */
+        emscripten_set_main_loop_timing(EM_TIMING_RAF, raf_interval);
+    }
+#endif
+    Uint64 current_counter = SDL_GetPerformanceCounter();
+    Uint64 frame_start = current_counter;
+    double elapsed = (double)(current_counter - last_counter) / SDL_GetPerformanceFrequency();
+    update_canvas_scale(elapsed - idle_seconds);
+    idle_seconds = 0.0;
+    last_counter = current_counter;
+
+    render_scene(advance_simulation(elapsed));
+
+    /* The governor weighs the work of the frame; waiting for vsync is not load */
+    double work = (double)(SDL_GetPerformanceCounter() - frame_start) / SDL_GetPerformanceFrequency();
+    governor_frame(work);
+
+    if (show_profile_hud) {
+        Uint64 t = profile_begin();
+        draw_profile_hud();
+        profile_end(PROFILE_HUD, t);
+    }
     
-    /* Update wind effect */
-    if (wind_in_transition) {
-        wind_transition_timer += delta;
-        float t = wind_transition_timer / wind_transition_duration;
-        if (t >= 1.0f) {
-            current_wind_angle = target_wind_angle;
-            wind_in_transition = false;
-            wind_idle_timer = 3.0f + ((float)rand() / (float)RAND_MAX) * 5.0f;
-            wind_transition_timer = 0.0f;
-            wind_transition_duration = 0.0f;
-        } else {
-            current_wind_angle = wind_start_angle + (target_wind_angle - wind_start_angle) * t;
+    Uint64 present_profile = profile_begin();
+    if (use_gpu_renderer) {
+        gpu_present();
+    } else {
+        SDL_RenderPresent(renderer);
+    }
+    profile_end(PROFILE_PRESENT, present_profile);
+
+    if (!first_frame_reported) {
+        first_frame_reported = true;
+        report_startup_time("first-frame");
+    }
+    if (full_glyph_set && !full_glyphs_reported) {
+        full_glyphs_reported = true;
+        report_startup_time("full-glyphs");
+    }
+    if (power_frame(work)) report_power_sample();
+
+    profile_count(PROFILE_LIVE_COLUMNS, (long long)columns.count);
+    profile_count(PROFILE_LIVE_PARTICLES, (long long)particles.count);
+    profile_count(PROFILE_GLYPHS_DRAWN, (long long)render_stats.glyphs_drawn);
+    profile_count(PROFILE_SIM_ALLOCATIONS, (long long)(sim_allocations - sim_allocations_seen));
+    sim_allocations_seen = sim_allocations;
+    profile_end(PROFILE_FRAME, frame_profile);
+    profile_frame_end();
+}
+
+#ifndef __EMSCRIPTEN__
+/* Render `frames` frames at `fps` without a visible window and stream them
+ * through storm_export, which must be open.  The simulation runs at the
+ * fixed step as fast as the machine allows.  Each frame is read back into a
+ * buffer the writer thread is not using, so the writer converts and writes
+ * frame N while frame N + 1 renders; the GL path additionally reads back
+ * through pixel pack buffers and collects frame N only after frame N + 1
+ * has been submitted.
+ */
+bool run_export(int frames, int fps) {
+    if (use_gpu_renderer) {
+        if (!gpu_set_offscreen(g_screen_width, g_screen_height)) {
+            export_close(NULL);
+            return false;
         }
     } else {
-        wind_idle_timer -= delta;
-        if (wind_idle_timer <= 0) {
-            wind_in_transition = true;
-            wind_transition_duration = 1.0f + (((float)rand() / (float)RAND_MAX) * 4.0f);
-            wind_transition_timer = 0.0f;
-            wind_start_angle = current_wind_angle;
-            target_wind_angle = -45.0f + (((float)rand() / (float)RAND_MAX) * 90.0f);
+        screen_target = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                          g_screen_width, g_screen_height);
+        if (!screen_target) {
+            printf("SDL_CreateTexture Error: %s\n", SDL_GetError());
+            export_close(NULL);
+            return false;
         }
     }
-    
-    SDL_SetRenderTarget(renderer, canvas);
-    /* Apply fade effect for trail */
-    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 200);
-    SDL_RenderFillRect(renderer, NULL);
-    
-    update_columns(delta);
-    render_columns();
-    
-    SDL_SetRenderTarget(renderer, NULL);
-    SDL_RenderCopy(renderer, canvas, NULL, NULL);
-    
-    /* Handle lightning effect */
-    if (lightning) {
-        lightning->timer -= delta;
-        if (lightning->effect_type == 1) { 
-            float alpha_factor = lightning->timer / lightning->initial_timer;
-            if (alpha_factor < 0) alpha_factor = 0;
-            Uint8 fade_alpha = (Uint8)(255 * alpha_factor);
-            SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
-            SDL_SetRenderDrawColor(renderer, 255, 255, 255, fade_alpha);
-            SDL_RenderFillRect(renderer, NULL);
-        } else {
-            draw_lightning(lightning);
-        }
-        if (lightning->timer <= 0) {
-            free(lightning->points);
-            for (int i = 0; i < lightning->num_branches; i++) {
-                free(lightning->branches[i].points);
+    printf("Exporting %d frames of %dx%d at %d fps\n", frames, g_screen_width, g_screen_height, fps);
+
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int f = 0; f < frames; f++) {
+        render_scene(advance_simulation(1.0 / fps));
+        if (use_gpu_renderer) {
+            gpu_begin_readback();
+            if (f > 0) {
+                gpu_end_readback(export_acquire());
+                export_submit(true);
             }
-            free(lightning->branches);
-            free(lightning);
-            lightning = NULL;
-        }
-    } else {
-        /* Approximately 0.6% chance per frame to spawn lightning */
-        if (rand() % 1000 < 6) {
-            lightning = generate_lightning();
+        } else {
+            unsigned char *pixels = export_acquire();
+            SDL_RenderReadPixels(renderer, NULL, SDL_PIXELFORMAT_RGBA32, pixels, g_screen_width * 4);
+            export_submit(false);
         }
     }
-    
-    SDL_RenderPresent(renderer);
+    if (use_gpu_renderer && frames > 0) {
+        gpu_end_readback(export_acquire());
+        export_submit(true);
+    }
+
+    ExportStats stats;
+    bool ok = export_close(&stats);
+    double seconds = (double)(SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+    printf("Exported %llu frames (%.1f MB) in %.2f s: %.1f frames/s; renderer waited %.2f s for the writer, "
+           "writer busy %.2f s\n",
+           stats.frames, stats.bytes / 1e6, seconds, seconds > 0.0 ? stats.frames / seconds : 0.0,
+           stats.render_wait_seconds, stats.write_seconds);
+    if (!ok) printf("Export output failed; the file is incomplete\n");
+    if (screen_target) {
+        SDL_DestroyTexture(screen_target);
+        screen_target = NULL;
+    }
+    return ok;
 }
+#endif
 
-/* Main entry point */
+/* Main entry point
+ *
+ * Options (all optional):
+ *   --seed S       seed the simulation with S instead of the current time
+ *   --steps N      fast-forward N simulation steps before the first frame
+ *   --size WxH     initial window size
+ *   --threads N    simulation worker threads including the main one (0 = one per CPU)
+ *   --lightning-detail N
+ *                  bolt subdivision levels, up to LIGHTNING_MAX_DETAIL (0 = from screen height)
+ *   --lightning-rate R
+ *                  strikes per second per 1000 px of width; up to LIGHTNING_SLOTS
+ *                  bolts and flashes are alive at once
+ *   --gusts R      gusts and vortices started per second per megapixel of screen;
+ *                  up to WIND_MAX_FEATURES are alive at once
+ *   --splash N     fragments thrown up by each glyph hitting the ground (0 = no splashes);
+ *                  up to PARTICLE_CAPACITY are alive at once
+ *   --trails MODE  "canvas" (default) or "analytic"; T toggles at runtime
+ *   --render-scale S
+ *                  fixed canvas resolution as a fraction of the window (0.5 to 1),
+ *                  or "auto" (default) to follow the frame time
+ *   --density D    target columns per 100 px of width, including the off-screen margins
+ *   --max-columns N
+ *                  hard limit on live columns
+ *   --governor MS  frame work budget of the load governor in ms, or "off";
+ *                  defaults to one refresh period of the display
+ *   --governor-max-tier N
+ *                  lowest quality tier the governor may pick (0 to GOVERNOR_NUM_TIERS - 1)
+ *   --renderer R   "sdl" (default) for SDL_Renderer or "gles3" for the
+ *                  OpenGL ES 3 / WebGL2 instanced renderer
+ *   --export PATH  native builds: render offline to PATH ("-" = stdout) instead of
+ *                  opening a window, then exit
+ *   --power MODE   "normal" (default) or "low": cap frames at POWER_LOW_FPS;
+ *                  either mode pauses while the window is hidden
+ *   --fps-cap N    frame rate limit (0 = the display rate)
+ *   --profile on   show the profiler overlay from the start; P toggles it
+ *   --trace PATH   native builds: write the profiler trace to PATH on quit
+ *                  (J writes it at any time, to storm_trace.json by default)
+ *   --export-frames N, --export-fps F, --export-format y4m|rgba
+ *                  length (default 600), rate (8 to 240, default 60) and format
+ *                  (default y4m) of the export
+ * Together they replay the state printed by print_replay_info() on quit.
+ */
 int main(int argc, char *argv[]) {
+    unsigned long long replay_steps = 0;
+    int num_threads = 0;
+    bool governor_enabled = true;
+    float governor_target_ms = 0.0f;  /* 0 = one refresh period */
+    int governor_max_tier = GOVERNOR_NUM_TIERS - 1;
+    const char *export_path = NULL;
+    int export_frames = 600;
+    int export_fps = 60;
+    ExportFormat export_format = EXPORT_Y4M;
+    bool low_power = false;
+    int fps_cap = -1;  /* -1 = from the power mode */
+    int exit_code = 1;
+    startup_counter = SDL_GetPerformanceCounter();
+    run_seed = (unsigned)time(NULL);
+    for (int i = 1; i < argc; i += 2) {
+        if (i + 1 == argc) {
+            printf("Usage: %s [--option VALUE]...\n%s needs a value\n", argv[0], argv[i]);
+            return 1;
+        }
+        if (strcmp(argv[i], "--seed") == 0) {
+            run_seed = (unsigned)strtoul(argv[i + 1], NULL, 10);
+        } else if (strcmp(argv[i], "--steps") == 0) {
+            replay_steps = strtoull(argv[i + 1], NULL, 10);
+        } else if (strcmp(argv[i], "--size") == 0) {
+            if (sscanf(argv[i + 1], "%dx%d", &g_screen_width, &g_screen_height) != 2 ||
+                g_screen_width <= 0 || g_screen_height <= 0) {
+                printf("Usage: %s [--option VALUE]...\n--size needs WIDTHxHEIGHT above 0x0, not %s\n",
+                       argv[0], argv[i + 1]);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--threads") == 0) {
+            num_threads = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "--lightning-detail") == 0) {
+            lightning_detail = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "--lightning-rate") == 0) {
+            lightning_rate = (float)atof(argv[i + 1]);
+            if (lightning_rate < 0.0f) lightning_rate = 0.0f;
+        } else if (strcmp(argv[i], "--gusts") == 0) {
+            wind_gust_rate = (float)atof(argv[i + 1]);
+            if (wind_gust_rate < 0.0f) wind_gust_rate = 0.0f;
+        } else if (strcmp(argv[i], "--splash") == 0) {
+            splash_fragments = atoi(argv[i + 1]);
+            if (splash_fragments < 0) splash_fragments = 0;
+        } else if (strcmp(argv[i], "--trails") == 0) {
+            trail_mode = strcmp(argv[i + 1], "analytic") == 0 ? TRAILS_ANALYTIC : TRAILS_CANVAS;
+        } else if (strcmp(argv[i], "--density") == 0) {
+            column_density = (float)atof(argv[i + 1]);
+        } else if (strcmp(argv[i], "--max-columns") == 0) {
+            column_cap = atoi(argv[i + 1]);
+            if (column_cap < 1) column_cap = 1;
+        } else if (strcmp(argv[i], "--governor") == 0) {
+            governor_enabled = strcmp(argv[i + 1], "off") != 0;
+            if (governor_enabled) governor_target_ms = (float)atof(argv[i + 1]);
+        } else if (strcmp(argv[i], "--governor-max-tier") == 0) {
+            governor_max_tier = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "--renderer") == 0) {
+            use_gpu_renderer = strcmp(argv[i + 1], "gles3") == 0;
+        } else if (strcmp(argv[i], "--power") == 0) {
+            low_power = strcmp(argv[i + 1], "low") == 0;
+        } else if (strcmp(argv[i], "--fps-cap") == 0) {
+            fps_cap = atoi(argv[i + 1]);
+            if (fps_cap < 0) fps_cap = 0;
+        } else if (strcmp(argv[i], "--profile") == 0) {
+            show_profile_hud = strcmp(argv[i + 1], "on") == 0;
+        } else if (strcmp(argv[i], "--trace") == 0) {
+            trace_path = argv[i + 1];
+            trace_on_quit = true;
+        } else if (strcmp(argv[i], "--export") == 0) {
+            export_path = argv[i + 1];
+        } else if (strcmp(argv[i], "--export-frames") == 0) {
+            export_frames = atoi(argv[i + 1]);
+        } else if (strcmp(argv[i], "--export-fps") == 0) {
+            /* Below 8 fps a frame would need more than MAX_STEPS_PER_FRAME steps */
+            export_fps = atoi(argv[i + 1]);
+            if (export_fps < 8) export_fps = 8;
+            if (export_fps > 240) export_fps = 240;
+        } else if (strcmp(argv[i], "--export-format") == 0) {
+            export_format = strcmp(argv[i + 1], "rgba") == 0 ? EXPORT_RGBA : EXPORT_Y4M;
+        } else if (strcmp(argv[i], "--render-scale") == 0) {
+            dynamic_resolution = strcmp(argv[i + 1], "auto") == 0;
+            if (!dynamic_resolution) {
+                /* Nearest available level */
+                float wanted = (float)atof(argv[i + 1]);
+                for (int l = 1; l < NUM_CANVAS_SCALES; l++) {
+                    if (fabsf(canvas_scales[l] - wanted) < fabsf(canvas_scales[canvas_scale_level] - wanted))
+                        canvas_scale_level = l;
+                }
+            }
+        } else {
+            printf("Unknown option: %s\n", argv[i]);
+        }
+    }
+
+#ifdef __EMSCRIPTEN__
+    export_path = NULL;  /* No file system or threads to export with */
+#endif
+    if (export_path) {
+        /* Exports are reproducible: no load-dependent quality changes */
+        governor_enabled = false;
+        dynamic_resolution = false;
+#ifndef __EMSCRIPTEN__
+        /* Opened first, so nothing printed below ends up in a stream on stdout */
+        if (!export_open(export_path, g_screen_width, g_screen_height, export_fps, export_format))
+            return 1;
+#endif
+    }
+
     // Enable linear texture filtering for smoother scaling
     SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
 
-    printf("Matrix Rain starting...\n");
-    srand((unsigned)time(NULL));
+    run_density = column_density;
+    apply_trail_style();
+    printf("Matrix Rain starting (column kernel: %s, seed: %u)...\n", column_kernel_name, run_seed);
+    storm_seed(run_seed);
     
     if (SDL_Init(SDL_INIT_VIDEO) != 0) {
         printf("SDL_Init Error: %s\n", SDL_GetError());
-        return 1;
-    }
-    if (TTF_Init() != 0) {
-        printf("TTF_Init Error: %s\n", TTF_GetError());
-        SDL_Quit();
-        return 1;
+        goto cleanup;
     }
-    
 #ifdef __EMSCRIPTEN__
     /* Set attributes for WebGL/OpenGL ES */
     SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 2);
@@ -903,95 +1134,141 @@ int main(int argc, char *argv[]) {
     SDL_GL_SetAttribute(SDL_GL_MULTISAMPLEBUFFERS, 1);
     SDL_GL_SetAttribute(SDL_GL_MULTISAMPLESAMPLES, 4);
 #endif
+    if (use_gpu_renderer) gpu_set_attributes();
     
     /* Create SDL window */
     window = SDL_CreateWindow("Matrix Rain Screen", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
                                 g_screen_width, g_screen_height,
-                                SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE | SDL_WINDOW_OPENGL);
+                                (export_path ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE) |
+                                SDL_WINDOW_OPENGL);
     if (!window) {
         printf("SDL_CreateWindow Error: %s\n", SDL_GetError());
-        TTF_Quit();
-        SDL_Quit();
-        return 1;
+        goto cleanup;
     }
     
-    /* Create renderer with hardware acceleration and vsync */
-    renderer = SDL_CreateRenderer(window, -1,
-                  SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
-    if (!renderer) {
-        printf("SDL_CreateRenderer Error: %s\n", SDL_GetError());
-        SDL_DestroyWindow(window);
-        TTF_Quit();
-        SDL_Quit();
-        return 1;
+    if (use_gpu_renderer) {
+        /* GL context and shaders for the instanced renderer; no SDL_Renderer */
+        if (!gpu_init(window)) goto cleanup;
+    } else {
+        /* Create renderer with hardware acceleration and vsync */
+        renderer = SDL_CreateRenderer(window, -1,
+                      SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE);
+        if (!renderer) {
+            printf("SDL_CreateRenderer Error: %s\n", SDL_GetError());
+            goto cleanup;
+        }
     }
     
-    font = TTF_OpenFont("matrix_font_subset.ttf", FONT_SIZE);
-    if (!font) {
-        printf("TTF_OpenFont Error: %s\n", TTF_GetError());
-        SDL_DestroyRenderer(renderer);
-        SDL_DestroyWindow(window);
-        TTF_Quit();
-        SDL_Quit();
-        return 1;
+    if (!init_glyph_atlas()) goto cleanup;
+
+    /* The frame time budget is one refresh of the window's display */
+    SDL_DisplayMode display_mode;
+    if (SDL_GetWindowDisplayMode(window, &display_mode) == 0 && display_mode.refresh_rate > 0) {
+        refresh_period = 1.0 / display_mode.refresh_rate;
     }
-    
-    init_unicode_textures();
-    
-    canvas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
-                               g_screen_width, g_screen_height);
-    if (!canvas) {
-        printf("SDL_CreateTexture Error: %s\n", SDL_GetError());
-        TTF_CloseFont(font);
-        SDL_DestroyRenderer(renderer);
-        SDL_DestroyWindow(window);
-        TTF_Quit();
-        SDL_Quit();
-        return 1;
+
+    /* Frame pacing: vsync alone unless there is a lower cap or no vsync */
+    if (fps_cap < 0) fps_cap = low_power ? POWER_LOW_FPS : 0;
+    double frame_period = fps_cap > 0 ? 1.0 / fps_cap : 0.0;
+    if (frame_period <= refresh_period) {
+        bool vsync = true;
+#ifndef __EMSCRIPTEN__
+        SDL_RendererInfo info;
+        if (use_gpu_renderer)
+            vsync = SDL_GL_GetSwapInterval() != 0;
+        else
+            vsync = SDL_GetRendererInfo(renderer, &info) == 0 && (info.flags & SDL_RENDERER_PRESENTVSYNC);
+#endif
+        frame_period = vsync ? 0.0 : refresh_period;
+    }
+    if (export_path) frame_period = 0.0;
+    power_init(frame_period);
+    if (frame_period > 0.0) {
+        /* Frames get the whole paced period as their budget */
+        raf_interval = (int)(frame_period / refresh_period + 0.5);
+        refresh_period = frame_period;
+        printf("Frame pacing: %.0f frames/s%s\n", 1.0 / frame_period, fps_cap > 0 ? " cap" : ", no vsync");
+    } else {
+        printf("Frame pacing: vsync\n");
+    }
+    if (governor_enabled) {
+        if (governor_target_ms <= 0.0f) governor_target_ms = (float)(refresh_period * 1000.0);
+        governor_init(governor_target_ms, governor_max_tier);
     }
-    SDL_SetRenderTarget(renderer, canvas);
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
-    SDL_SetRenderTarget(renderer, NULL);
     
-    last_ticks = SDL_GetTicks();
+    if (trail_mode == TRAILS_CANVAS && !create_canvas()) goto cleanup;
     
-    /* Allocate array for falling columns */
-    columns_capacity = 16;
-    columns = malloc(columns_capacity * sizeof(Column *));
-    if (!columns) {
-        printf("Failed to allocate columns array.\n");
-        TTF_CloseFont(font);
-        SDL_DestroyRenderer(renderer);
-        SDL_DestroyWindow(window);
-        TTF_Quit();
-        SDL_Quit();
-        return 1;
+    /* Allocate pool for falling columns */
+    /* The whole pool up front: spawning then only refills freed slots */
+    if (!reserve_columns(column_cap)) {
+        printf("Failed to allocate column pool.\n");
+        goto cleanup;
+    }
+
+    /* Lightning slots and their mesh arena, also up front */
+    if (!reserve_lightning()) {
+        printf("Failed to allocate lightning pool.\n");
+        goto cleanup;
+    }
+
+    /* Splash particles, also up front; the storm runs without them if this fails */
+    if (!reserve_particles()) {
+        printf("Failed to allocate particle pool; splashes are off\n");
+        splash_fragments = 0;
+    }
+
+    /* Simulation workers; rendering stays on this thread */
+    pool_init(num_threads);
+    printf("Simulation threads: %d\n", pool_worker_count());
+
+    /* Fast-forward to the replayed step without rendering */
+    while (sim_steps < replay_steps) {
+        step_simulation(SIM_STEP);
     }
+    profile_init();  /* The fast-forward is not part of any frame */
+    sim_allocations_seen = sim_allocations;
+    last_counter = SDL_GetPerformanceCounter();
+    exit_code = 0;
     
 #ifdef __EMSCRIPTEN__
+    emscripten_set_visibilitychange_callback(NULL, EM_FALSE, on_visibility_change);
     emscripten_set_main_loop_arg(main_loop, NULL, 0, 1);
 #else
-    while (1) {
-        main_loop(NULL);
-        SDL_Delay(16);  /* ~60 FPS */
+    if (export_path) {
+        exit_code = run_export(export_frames, export_fps) ? 0 : 1;
+        print_replay_info();
+    } else {
+        while (1) {
+            if (power_paused()) {
+                /* Nothing to draw: sleep until an event, e.g. the window coming back */
+                SDL_WaitEvent(NULL);
+                handle_events();
+                continue;
+            }
+            main_loop(NULL);
+            idle_seconds = power_wait_next_frame();
+        }
     }
 #endif
     
-    /* Cleanup (unreachable in some environments) */
-    for (int i = 0; i < NUM_UNICODE_CHARS; i++) {
-        if (unicode_textures[i])
-            SDL_DestroyTexture(unicode_textures[i]);
-    }
-    for (size_t i = 0; i < num_columns; i++) {
-        destroy_column(columns[i]);
-    }
-    free(columns);
+    /* Cleanup (reached after an export or a failed startup; the interactive
+     * loop never returns) */
+cleanup:
+#ifndef __EMSCRIPTEN__
+    export_close(NULL);
+#endif
+    if (glyph_atlas) SDL_DestroyTexture(glyph_atlas);
+    free(glyph_vertices);
+    free(glyph_indices);
+    free_columns();
+    free_lightning();
+    free_wind();
+    free_particles();
+    pool_shutdown();
     if (canvas) SDL_DestroyTexture(canvas);
-    if (font) TTF_CloseFont(font);
+    gpu_shutdown();
     if (renderer) SDL_DestroyRenderer(renderer);
     if (window) SDL_DestroyWindow(window);
-    TTF_Quit();
     SDL_Quit();
-    return 0;
+    return exit_code;
 }
@@ -0,0 +1,388 @@
+/*
+ * storm_atlas.c
+ *
+ * Glyph atlas baking and loading.  See storm_atlas.h.
+ *
+ * File layout, no padding, every field little-endian whatever the host:
+ *   AtlasFileHeader
+ *   AtlasGlyph[glyph_count]
+ *   Uint8 coverage[width * height]
+ * The coverage is stored uncompressed so a mapped file can be used in place.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#if !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+#define ATLAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "storm_atlas.h"
+
+#define ATLAS_MAGIC "STORMATL"
+#define ATLAS_VERSION 1
+
+typedef struct {
+    char magic[8];
+    Uint32 version;
+    Uint32 glyph_count;
+    Uint32 charset_hash;      /* Of unicode_chars[]; a changed set makes the file stale */
+    Uint16 width, height;
+    Uint16 char_width, char_height;
+    Uint16 font_size;         /* Informational: point size the atlas was baked at */
+    Uint16 reserved;
+} AtlasFileHeader;
+
+_Static_assert(sizeof(AtlasFileHeader) == 32, "atlas header must not be padded");
+_Static_assert(sizeof(AtlasGlyph) == 8, "atlas glyph entries must not be padded");
+
+/* Convert a header or glyph rectangles between file (little-endian) and host
+ * byte order; either way round is the same swap, a no-op on little-endian
+ * hosts */
+static void header_byte_order(AtlasFileHeader *header) {
+    header->version = SDL_SwapLE32(header->version);
+    header->glyph_count = SDL_SwapLE32(header->glyph_count);
+    header->charset_hash = SDL_SwapLE32(header->charset_hash);
+    header->width = SDL_SwapLE16(header->width);
+    header->height = SDL_SwapLE16(header->height);
+    header->char_width = SDL_SwapLE16(header->char_width);
+    header->char_height = SDL_SwapLE16(header->char_height);
+    header->font_size = SDL_SwapLE16(header->font_size);
+}
+
+static void glyphs_byte_order(AtlasGlyph *glyphs) {
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++) {
+        glyphs[i].x = SDL_SwapLE16(glyphs[i].x);
+        glyphs[i].y = SDL_SwapLE16(glyphs[i].y);
+        glyphs[i].w = SDL_SwapLE16(glyphs[i].w);
+        glyphs[i].h = SDL_SwapLE16(glyphs[i].h);
+    }
+}
+
+/* FNV-1a over every character string, terminators included */
+static Uint32 charset_hash(void) {
+    Uint32 hash = 2166136261u;
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++) {
+        const unsigned char *c = (const unsigned char *)unicode_chars[i];
+        do {
+            hash = (hash ^ *c) * 16777619u;
+        } while (*c++);
+    }
+    return hash;
+}
+
+/* Read the whole file into the atlas' storage, mapped where possible */
+static bool read_file(const char *path, GlyphAtlas *atlas) {
+#ifdef ATLAS_MMAP
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    void *data = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+        data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+    atlas->storage = data;
+    atlas->storage_size = (size_t)st.st_size;
+    atlas->mapped = true;
+    return true;
+#else
+    /* Under Emscripten only files preloaded into the virtual file system exist */
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    void *data = NULL;
+    long size = -1;
+    if (fseek(f, 0, SEEK_END) == 0) size = ftell(f);
+    if (size > 0 && fseek(f, 0, SEEK_SET) == 0) {
+        data = malloc((size_t)size);
+        if (data && fread(data, 1, (size_t)size, f) != (size_t)size) {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(f);
+    if (!data) return false;
+    atlas->storage = data;
+    atlas->storage_size = (size_t)size;
+    atlas->mapped = false;
+    return true;
+#endif
+}
+
+bool atlas_load_memory(const void *data, size_t size, const char *name, GlyphAtlas *atlas) {
+    memset(atlas, 0, sizeof(*atlas));
+    const Uint8 *bytes = data;
+    AtlasFileHeader header;
+    const char *problem = NULL;
+    if (size < sizeof(header)) {
+        problem = "truncated";
+    } else {
+        memcpy(&header, bytes, sizeof(header));
+        header_byte_order(&header);
+        size_t glyphs_size = (size_t)header.glyph_count * sizeof(AtlasGlyph);
+        if (memcmp(header.magic, ATLAS_MAGIC, 8) != 0 || header.version != ATLAS_VERSION)
+            problem = "unknown format or version";
+        else if (header.glyph_count != NUM_UNICODE_CHARS || header.charset_hash != charset_hash())
+            problem = "baked from a different character set";
+        else if (size != sizeof(header) + glyphs_size + (size_t)header.width * header.height)
+            problem = "wrong size";
+    }
+    if (!problem) {
+        atlas->width = header.width;
+        atlas->height = header.height;
+        atlas->char_width = header.char_width;
+        atlas->char_height = header.char_height;
+        memcpy(atlas->glyphs, bytes + sizeof(header), sizeof(atlas->glyphs));
+        glyphs_byte_order(atlas->glyphs);
+        atlas->coverage = bytes + sizeof(header) + sizeof(atlas->glyphs);
+        for (size_t i = 0; i < NUM_UNICODE_CHARS && !problem; i++) {
+            const AtlasGlyph *g = &atlas->glyphs[i];
+            if (g->x + g->w > atlas->width || g->y + g->h > atlas->height)
+                problem = "glyph outside the atlas";
+        }
+    }
+    if (problem) {
+        printf("Ignoring glyph atlas %s: %s\n", name, problem);
+        atlas->coverage = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool atlas_load(const char *path, GlyphAtlas *atlas) {
+    GlyphAtlas file;
+    memset(&file, 0, sizeof(file));
+    if (!read_file(path, &file)) {
+        memset(atlas, 0, sizeof(*atlas));
+        return false;
+    }
+    if (!atlas_load_memory(file.storage, file.storage_size, path, atlas)) {
+        atlas_free(&file);
+        return false;
+    }
+    atlas->storage = file.storage;
+    atlas->storage_size = file.storage_size;
+    atlas->mapped = file.mapped;
+    return true;
+}
+
+bool atlas_save(const char *path, const GlyphAtlas *atlas, int font_size) {
+    AtlasFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ATLAS_MAGIC, 8);
+    header.version = ATLAS_VERSION;
+    header.glyph_count = NUM_UNICODE_CHARS;
+    header.charset_hash = charset_hash();
+    header.width = (Uint16)atlas->width;
+    header.height = (Uint16)atlas->height;
+    header.char_width = (Uint16)atlas->char_width;
+    header.char_height = (Uint16)atlas->char_height;
+    header.font_size = (Uint16)font_size;
+    header_byte_order(&header);
+    AtlasGlyph glyphs[NUM_UNICODE_CHARS];
+    memcpy(glyphs, atlas->glyphs, sizeof(glyphs));
+    glyphs_byte_order(glyphs);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        printf("Cannot create %s\n", path);
+        return false;
+    }
+    size_t coverage_size = (size_t)atlas->width * atlas->height;
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(glyphs, sizeof(glyphs), 1, f) == 1 &&
+              fwrite(atlas->coverage, 1, coverage_size, f) == coverage_size;
+    if (fclose(f) != 0) ok = false;
+    if (!ok) printf("Failed to write %s\n", path);
+    return ok;
+}
+
+SDL_Surface *atlas_to_surface(const GlyphAtlas *atlas) {
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, atlas->width, atlas->height, 32,
+                                                          SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        printf("SDL_CreateRGBSurfaceWithFormat Error: %s\n", SDL_GetError());
+        return NULL;
+    }
+    for (int y = 0; y < atlas->height; y++) {
+        const Uint8 *src = atlas->coverage + (size_t)y * atlas->width;
+        Uint32 *dst = (Uint32 *)((Uint8 *)surface->pixels + (size_t)y * surface->pitch);
+        for (int x = 0; x < atlas->width; x++)
+            dst[x] = ((Uint32)src[x] << 24) | 0xFFFFFF;
+    }
+    return surface;
+}
+
+/* 5x7 bitmap font of the fallback set, one byte per row, bit 4 leftmost */
+#define FALLBACK_GLYPHS 36
+#define FALLBACK_SCALE 2
+static const Uint8 fallback_font[FALLBACK_GLYPHS][7] = {
+    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },  /* 0 */
+    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },  /* 1 */
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },  /* 2 */
+    { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },  /* 3 */
+    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },  /* 4 */
+    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },  /* 5 */
+    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },  /* 6 */
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },  /* 7 */
+    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },  /* 8 */
+    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },  /* 9 */
+    { 0x0E, 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11 },  /* A */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E },  /* B */
+    { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E },  /* C */
+    { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C },  /* D */
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F },  /* E */
+    { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 },  /* F */
+    { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F },  /* G */
+    { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 },  /* H */
+    { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E },  /* I */
+    { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C },  /* J */
+    { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 },  /* K */
+    { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F },  /* L */
+    { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 },  /* M */
+    { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 },  /* N */
+    { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },  /* O */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 },  /* P */
+    { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D },  /* Q */
+    { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 },  /* R */
+    { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E },  /* S */
+    { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 },  /* T */
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E },  /* U */
+    { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 },  /* V */
+    { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A },  /* W */
+    { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 },  /* X */
+    { 0x11, 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04 },  /* Y */
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F },  /* Z */
+};
+
+/* Index into fallback_font[] standing in for unicode_chars[i] */
+static int fallback_glyph(size_t i) {
+    const char *c = unicode_chars[i];
+    if (c[0] != '\0' && c[1] == '\0') {
+        if (c[0] >= '0' && c[0] <= '9') return c[0] - '0';
+        if (c[0] >= 'A' && c[0] <= 'Z') return 10 + c[0] - 'A';
+        if (c[0] >= 'a' && c[0] <= 'z') return 10 + c[0] - 'a';
+    }
+    return (int)(i % FALLBACK_GLYPHS);
+}
+
+/* The fallback glyphs fill a 6x6 grid of whole cells, the bitmap centered
+ * in each, so they are drawn unstretched at the cell size. */
+bool atlas_fallback(GlyphAtlas *atlas) {
+    const int grid_cols = 6;
+    const int cell_w = FALLBACK_CHAR_WIDTH + 2 * ATLAS_PADDING;
+    const int cell_h = FALLBACK_CHAR_HEIGHT + 2 * ATLAS_PADDING;
+    memset(atlas, 0, sizeof(*atlas));
+    atlas->char_width = FALLBACK_CHAR_WIDTH;
+    atlas->char_height = FALLBACK_CHAR_HEIGHT;
+    atlas->width = grid_cols * cell_w;
+    atlas->height = (FALLBACK_GLYPHS + grid_cols - 1) / grid_cols * cell_h;
+
+    Uint8 *coverage = calloc((size_t)atlas->width * atlas->height, 1);
+    if (!coverage) {
+        printf("Out of memory for the glyph atlas\n");
+        return false;
+    }
+    atlas->storage = coverage;
+    atlas->coverage = coverage;
+
+    AtlasGlyph cells[FALLBACK_GLYPHS];
+    for (int f = 0; f < FALLBACK_GLYPHS; f++) {
+        AtlasGlyph *g = &cells[f];
+        g->x = (Uint16)((f % grid_cols) * cell_w + ATLAS_PADDING);
+        g->y = (Uint16)((f / grid_cols) * cell_h + ATLAS_PADDING);
+        g->w = FALLBACK_CHAR_WIDTH;
+        g->h = FALLBACK_CHAR_HEIGHT;
+        int left = g->x + (FALLBACK_CHAR_WIDTH - 5 * FALLBACK_SCALE) / 2;
+        int top = g->y + (FALLBACK_CHAR_HEIGHT - 7 * FALLBACK_SCALE) / 2;
+        for (int y = 0; y < 7 * FALLBACK_SCALE; y++) {
+            Uint8 row = fallback_font[f][y / FALLBACK_SCALE];
+            Uint8 *dst = coverage + (size_t)(top + y) * atlas->width + left;
+            for (int x = 0; x < 5 * FALLBACK_SCALE; x++)
+                dst[x] = (row & (0x10 >> (x / FALLBACK_SCALE))) ? 255 : 0;
+        }
+    }
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++)
+        atlas->glyphs[i] = cells[fallback_glyph(i)];
+    return true;
+}
+
+void atlas_free(GlyphAtlas *atlas) {
+#ifdef ATLAS_MMAP
+    if (atlas->mapped) {
+        munmap(atlas->storage, atlas->storage_size);
+    } else
+#endif
+    {
+        free(atlas->storage);
+    }
+    atlas->storage = NULL;
+    atlas->coverage = NULL;
+}
+
+#ifndef STORM_NO_TTF
+/* Pack all characters into a roughly square grid of equal cells.  Each
+ * glyph is rendered once with SDL_ttf and its alpha copied into its cell. */
+bool atlas_render(TTF_Font *font, GlyphAtlas *atlas) {
+    SDL_Surface *surfaces[NUM_UNICODE_CHARS];
+    SDL_Color white = { 255, 255, 255, 255 };
+    int cell_w = 0, cell_h = 0;
+    memset(atlas, 0, sizeof(*atlas));
+
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++) {
+        /* Render using blended rendering for anti-aliased text */
+        SDL_Surface *rendered = TTF_RenderUTF8_Blended(font, unicode_chars[i], white);
+        surfaces[i] = rendered ? SDL_ConvertSurfaceFormat(rendered, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+        if (rendered) SDL_FreeSurface(rendered);
+        if (!surfaces[i]) {
+            printf("Failed to render '%s': %s\n", unicode_chars[i], TTF_GetError());
+            continue;
+        }
+        if (surfaces[i]->w > cell_w) cell_w = surfaces[i]->w;
+        if (surfaces[i]->h > cell_h) cell_h = surfaces[i]->h;
+    }
+    /* Set character dimensions based on the first glyph */
+    if (surfaces[0]) {
+        atlas->char_width = surfaces[0]->w;
+        atlas->char_height = surfaces[0]->h;
+    }
+
+    cell_w += 2 * ATLAS_PADDING;
+    cell_h += 2 * ATLAS_PADDING;
+    int grid_cols = (int)ceilf(sqrtf((float)NUM_UNICODE_CHARS));
+    int grid_rows = ((int)NUM_UNICODE_CHARS + grid_cols - 1) / grid_cols;
+    atlas->width = grid_cols * cell_w;
+    atlas->height = grid_rows * cell_h;
+
+    Uint8 *coverage = calloc((size_t)atlas->width * atlas->height, 1);
+    atlas->storage = coverage;
+    atlas->coverage = coverage;
+    for (size_t i = 0; i < NUM_UNICODE_CHARS; i++) {
+        SDL_Surface *s = surfaces[i];
+        if (!s) continue;
+        if (coverage && SDL_LockSurface(s) == 0) {
+            AtlasGlyph *g = &atlas->glyphs[i];
+            g->x = (Uint16)((int)(i % grid_cols) * cell_w + ATLAS_PADDING);
+            g->y = (Uint16)((int)(i / grid_cols) * cell_h + ATLAS_PADDING);
+            g->w = (Uint16)s->w;
+            g->h = (Uint16)s->h;
+            for (int y = 0; y < s->h; y++) {
+                const Uint32 *src = (const Uint32 *)((const Uint8 *)s->pixels + (size_t)y * s->pitch);
+                Uint8 *dst = coverage + (size_t)(g->y + y) * atlas->width + g->x;
+                for (int x = 0; x < s->w; x++)
+                    dst[x] = (Uint8)(src[x] >> 24);
+            }
+            SDL_UnlockSurface(s);
+        }
+        SDL_FreeSurface(s);
+    }
+    if (!coverage) printf("Out of memory for the glyph atlas\n");
+    return coverage != NULL;
+}
+#endif
@@ -0,0 +1,82 @@
+/*
+ * storm_atlas.h
+ *
+ * Glyph atlas: every character of unicode_chars[] rasterized once into a
+ * grid of equal cells.  Only coverage is kept, since glyphs are drawn white
+ * and tinted by vertex color.
+ *
+ * The atlas is normally baked at build time by storm_bake and loaded from a
+ * file, so startup does no FreeType work.  Rendering it with SDL_ttf at
+ * runtime remains as a fallback unless the program is built with
+ * STORM_NO_TTF.  A tiny bitmap set compiled into the program covers the time
+ * until the web build has fetched the baked file, or runs when neither is
+ * available.
+ */
+
+#ifndef STORM_ATLAS_H
+#define STORM_ATLAS_H
+
+#include <stdbool.h>
+#include <SDL2/SDL.h>
+
+#ifndef STORM_NO_TTF
+#include <SDL2/SDL_ttf.h>
+#endif
+
+#include "storm_sim.h"
+
+/* Baked atlas file loaded at startup */
+#define BAKED_ATLAS_PATH "matrix_glyphs.atlas"
+
+/* Padding around each atlas cell so linear filtering never samples a neighbor */
+#define ATLAS_PADDING 1
+
+/* Cell size of the embedded fallback set, close to the cells of the 16 pt font */
+#define FALLBACK_CHAR_WIDTH 14
+#define FALLBACK_CHAR_HEIGHT 20
+
+/* Rectangle of one glyph in the atlas, in pixels; w == 0 if it failed to render */
+typedef struct {
+    Uint16 x, y, w, h;
+} AtlasGlyph;
+
+typedef struct {
+    int width, height;        /* Atlas size in pixels */
+    int char_width, char_height;  /* Cell size of the first glyph, used for layout */
+    AtlasGlyph glyphs[NUM_UNICODE_CHARS];
+    const Uint8 *coverage;    /* width * height alpha values, rows top to bottom */
+
+    void *storage;            /* Owner of coverage: a heap block, a file mapping or NULL */
+    size_t storage_size;
+    bool mapped;
+} GlyphAtlas;
+
+/* Load a baked atlas.  Fails if the file is missing, malformed or was baked
+ * from a different character set. */
+bool atlas_load(const char *path, GlyphAtlas *atlas);
+
+/* Same as atlas_load() for a file already in memory, e.g. fetched over the
+ * network; `name` is only used in messages.  The atlas refers to `data`
+ * instead of copying it, so it is only valid while `data` is. */
+bool atlas_load_memory(const void *data, size_t size, const char *name, GlyphAtlas *atlas);
+
+/* Atlas of the embedded fallback set: digits and capital Latin letters from a
+ * 5x7 bitmap font compiled into the program.  Every character maps to one of
+ * them (letters case-insensitively, the rest round-robin), so the rain can
+ * start before the real atlas is available. */
+bool atlas_fallback(GlyphAtlas *atlas);
+
+/* Write an atlas in the format atlas_load() reads */
+bool atlas_save(const char *path, const GlyphAtlas *atlas, int font_size);
+
+/* White ARGB8888 surface with the atlas coverage as alpha */
+SDL_Surface *atlas_to_surface(const GlyphAtlas *atlas);
+
+void atlas_free(GlyphAtlas *atlas);
+
+#ifndef STORM_NO_TTF
+/* Rasterize unicode_chars[] with font */
+bool atlas_render(TTF_Font *font, GlyphAtlas *atlas);
+#endif
+
+#endif /* STORM_ATLAS_H */
@@ -0,0 +1,76 @@
+/*
+ * storm_bake.c
+ *
+ * Build-time tool that rasterizes unicode_chars[] once and writes the glyph
+ * atlas the program loads at startup (see storm_atlas.h), so the program
+ * itself does no FreeType work and can be built without SDL_ttf.  Run it
+ * again whenever the font, its size or the character set changes; an atlas
+ * baked from a different character set is rejected at load time.
+ *
+ * Usage: storm_bake [--font FILE] [--size POINTS] [--out FILE]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include "storm_atlas.h"
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [--font FILE] [--size POINTS] [--out FILE]\n", prog);
+}
+
+int main(int argc, char *argv[]) {
+    const char *font_path = "matrix_font_subset.ttf";
+    const char *out_path = BAKED_ATLAS_PATH;
+    int font_size = 16;  /* FONT_SIZE of matrix_storm.c */
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+            return 1;
+        }
+        const char *val = argv[++i];
+        if (strcmp(opt, "--font") == 0) font_path = val;
+        else if (strcmp(opt, "--size") == 0) font_size = atoi(val);
+        else if (strcmp(opt, "--out") == 0) out_path = val;
+        else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (font_size <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    /* SDL_ttf only needs the surface code, no video subsystem */
+    if (TTF_Init() != 0) {
+        printf("TTF_Init Error: %s\n", TTF_GetError());
+        return 1;
+    }
+    TTF_Font *font = TTF_OpenFont(font_path, font_size);
+    if (!font) {
+        printf("TTF_OpenFont Error: %s\n", TTF_GetError());
+        TTF_Quit();
+        return 1;
+    }
+
+    GlyphAtlas atlas;
+    bool ok = atlas_render(font, &atlas) && atlas_save(out_path, &atlas, font_size);
+    if (ok) {
+        int rendered = 0;
+        for (size_t i = 0; i < NUM_UNICODE_CHARS; i++)
+            rendered += atlas.glyphs[i].w > 0;
+        printf("Baked %d of %d glyphs from %s at %d pt: %dx%d atlas, %dx%d cells, %s\n",
+               rendered, NUM_UNICODE_CHARS, font_path, font_size, atlas.width, atlas.height,
+               atlas.char_width, atlas.char_height, out_path);
+    }
+    atlas_free(&atlas);
+    TTF_CloseFont(font);
+    TTF_Quit();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,567 @@
+/*
+ * storm_bench.c
+ *
+ * Headless benchmark for the Matrix Rain simulation.  Runs the column, wind,
+ * lightning and splash simulation for a fixed number of frames at a fixed
+ * time step from a fixed seed, without opening a window, and prints the
+ * results as a single JSON object on stdout.
+ *
+ * With --check 1 it also verifies the simulation as it runs: the particle
+ * pool's invariants after every step and the light grid against the brute
+ * force reference.  Violations are reported on stderr and make the run
+ * fail.  The JSON ends with a digest of the final state, so runs that must
+ * agree (other thread counts, the same seed twice) can be compared; `make
+ * check` does that.
+ *
+ * Usage: storm_bench [--frames N] [--delta SECONDS] [--seed S]
+ *                    [--width W] [--height H] [--density COLUMNS_PER_100PX]
+ *                    [--char-width W] [--char-height H] [--lightning N]
+ *                    [--columns N] [--max-columns N] [--threads N]
+ *                    [--lightning-detail N] [--gusts R] [--splash N]
+ *                    [--particles N] [--check 0|1]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include <SDL2/SDL.h>
+
+#include "storm_sim.h"
+#include "storm_pool.h"
+
+/* Benchmark configuration */
+typedef struct {
+    int frames;               /* Number of simulated frames */
+    float delta;              /* Fixed time step in seconds */
+    unsigned seed;            /* Seed of the simulation streams */
+    int width, height;        /* Simulated screen size */
+    float density;            /* Target columns per 100 px of spawn span */
+    int char_width;           /* Glyph size; normally measured from the font */
+    int char_height;
+    int lightning_runs;       /* Number of bolts generated for the lightning timings */
+    int initial_columns;      /* Columns spawned before the first frame */
+    int max_columns;          /* Hard limit on live columns */
+    int threads;              /* Worker threads including the main one; 0 = one per CPU */
+    int lightning_detail;     /* Bolt subdivision levels; 0 = from screen height */
+    float gusts;              /* Gusts and vortices per second per megapixel */
+    int splash;               /* Fragments per glyph hitting the ground */
+    int stress_particles;     /* Live particles held for the particle timings */
+    int check;                /* Verify invariants and error bounds */
+} BenchConfig;
+
+/* Largest difference --check allows between lightning_light_at() and the
+ * brute force reference.  The light segments stay within 4 px of the bolt,
+ * and the falloff changes by at most 0.064 over 4 px of a 96 px radius. */
+#define CHECK_LIGHT_ERROR 0.08f
+
+/* Slack of the position checks in pixels */
+#define CHECK_EPSILON 1e-3f
+
+/* Glyphs of the current frame, taken from the instance stream that
+ * render_columns() draws: pixels of the glyphs and splash fragments in
+ * view, pixels of the analytic-mode ghosts in view, and the number of
+ * glyphs, fragments and columns drawn and culled.
+ */
+typedef struct {
+    double glyph_pixels, ghost_pixels;
+    unsigned long long glyphs_drawn, glyphs_culled, fragments_drawn;
+    unsigned long long columns_drawn, columns_culled;
+} GlyphFill;
+
+static void count_glyph_fill(GlyphFill *fill) {
+    for (size_t i = 0; i < glyph_stream.fragments; i++) {
+        float scale = glyph_stream.fragment_instances[i].scale;
+        fill->glyph_pixels += char_width * char_height * 0.25f * scale * scale;
+    }
+    fill->fragments_drawn += glyph_stream.fragments;
+    for (size_t i = 0; i < glyph_stream.count; i++) {
+        const GlyphInstance *inst = &glyph_stream.instances[i];
+        float area = (float)(int)(char_width * inst->scale) * char_height;
+        if (inst->flags & GLYPH_GHOST) {
+            fill->ghost_pixels += area;
+        } else {
+            fill->glyph_pixels += area;
+            fill->glyphs_drawn++;
+        }
+    }
+    fill->glyphs_culled += glyph_stream.glyphs_culled;
+    fill->columns_drawn += glyph_stream.columns_drawn;
+    fill->columns_culled += glyph_stream.columns_culled;
+}
+
+/* Segment light term of lightning_light_at(); fade is the bolt's */
+static float segment_light(float x, float y, const SDL_FPoint *a, const SDL_FPoint *b, float fade) {
+    float dx = b->x - a->x, dy = b->y - a->y;
+    float length2 = dx * dx + dy * dy;
+    float px = x - a->x, py = y - a->y;
+    float t = length2 > 0.0f ? (px * dx + py * dy) / length2 : 0.0f;
+    t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+    float qx = px - t * dx, qy = py - t * dy;
+    float falloff = 1.0f - (qx * qx + qy * qy) / (LIGHTNING_LIGHT_RADIUS * LIGHTNING_LIGHT_RADIUS);
+    return falloff > 0.0f ? fade * falloff * falloff : 0.0f;
+}
+
+/* Reference for lightning_light_at(): every segment of every live bolt, at
+ * full resolution rather than the coarser light segments */
+static float brute_force_light(float x, float y) {
+    float best = 0.0f;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        if (!l->active) continue;
+        float fade = l->timer / l->initial_timer;
+        for (int p = 0; p + 1 < l->num_points; p++)
+            best = fmaxf(best, segment_light(x, y, &l->points[p], &l->points[p + 1], fade));
+        for (int k = 0; k < l->num_branches; k++) {
+            const LightningBranch *b = &l->branches[k];
+            for (int p = 0; p + 1 < b->num_points; p++)
+                best = fmaxf(best, segment_light(x, y, &b->points[p], &b->points[p + 1], fade));
+        }
+    }
+    return best;
+}
+
+/* Violations found by --check */
+static unsigned long check_failures = 0;
+
+static void check_failed(int frame, const char *what, size_t index) {
+    if (check_failures++ < 20)
+        fprintf(stderr, "check failed at frame %d: %s (%zu)\n", frame, what, index);
+}
+
+/*
+ * Invariants of the particle pool after update_particles(): allocated
+ * exactly when splashes are on, within capacity, no more particles than
+ * survived plus were emitted, every live particle alive, within the
+ * retention bounds, at or above the ground and with a unit orientation, and
+ * the fragment instances in step with the particles, starting their
+ * interpolation at or above the ground too.
+ */
+static void check_particles(int frame, size_t count_before, unsigned long long emitted_before) {
+    if (particles.x && splash_fragments == 0)
+        check_failed(frame, "pool allocated with splashes off", 0);
+    if (!particles.x) {
+        if (splash_fragments > 0) check_failed(frame, "splashes on without a pool", 0);
+        if (glyph_stream.fragment_instances || glyph_stream.fragments)
+            check_failed(frame, "fragments without a pool", glyph_stream.fragments);
+        return;
+    }
+    if (particles.count > PARTICLE_CAPACITY)
+        check_failed(frame, "pool over capacity", particles.count);
+    if (particles.count > count_before + (particles.emitted - emitted_before))
+        check_failed(frame, "more particles than survived and were emitted", particles.count);
+    if (glyph_stream.fragments != particles.count)
+        check_failed(frame, "fragment count differs from the pool", glyph_stream.fragments);
+
+    float ground = g_screen_height - char_height * 0.25f;  /* As update_particles() bounces them */
+    for (size_t i = 0; i < particles.count; i++) {
+        float x = particles.x[i], y = particles.y[i];
+        float s = particles.sine[i], c = particles.cosine[i];
+        if (!(particles.life[i] > 0.0f)) check_failed(frame, "dead particle kept", i);
+        if (x < -char_width || x > g_screen_width + char_width) check_failed(frame, "particle out of bounds", i);
+        if (y > ground + CHECK_EPSILON) check_failed(frame, "particle below the ground", i);
+        if (fabsf(s * s + c * c - 1.0f) > 1e-3f) check_failed(frame, "orientation not normalized", i);
+        if (particles.glyph[i] >= NUM_UNICODE_CHARS || !(particles.flags[i] & GLYPH_FRAGMENT))
+            check_failed(frame, "bad fragment glyph or flags", i);
+
+        const GlyphInstance *inst = &glyph_stream.fragment_instances[i];
+        if (inst->x != x || inst->y != y || inst->glyph != particles.glyph[i])
+            check_failed(frame, "fragment instance out of step", i);
+        if (inst->y - inst->my > ground + CHECK_EPSILON)
+            check_failed(frame, "fragment interpolates below the ground", i);
+    }
+}
+
+/* FNV-1a over `size` bytes, continuing from hash */
+static uint64_t digest_bytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+/* Digest of the live columns, the glyph stream and the particles, bit for
+ * bit */
+static uint64_t state_digest(void) {
+    uint64_t hash = 14695981039346656037ull;
+    size_t n = columns.count;
+    hash = digest_bytes(hash, &n, sizeof(n));
+    hash = digest_bytes(hash, columns.x, n * sizeof(float));
+    hash = digest_bytes(hash, columns.y, n * sizeof(float));
+    hash = digest_bytes(hash, columns.vx, n * sizeof(float));
+    hash = digest_bytes(hash, columns.vy, n * sizeof(float));
+    hash = digest_bytes(hash, columns.length, n * sizeof(int));
+    hash = digest_bytes(hash, columns.indices, n * MAX_COLUMN_LENGTH * sizeof(int));
+    hash = digest_bytes(hash, glyph_stream.instances, glyph_stream.count * sizeof(GlyphInstance));
+    n = particles.count;
+    hash = digest_bytes(hash, &n, sizeof(n));
+    if (particles.x) {
+        hash = digest_bytes(hash, particles.x, n * sizeof(float));
+        hash = digest_bytes(hash, particles.y, n * sizeof(float));
+        hash = digest_bytes(hash, particles.vx, n * sizeof(float));
+        hash = digest_bytes(hash, particles.vy, n * sizeof(float));
+        hash = digest_bytes(hash, particles.life, n * sizeof(float));
+    }
+    return hash;
+}
+
+/* Nanoseconds elapsed between two performance counter readings */
+static double elapsed_ns(Uint64 start, Uint64 end) {
+    return (double)(end - start) * 1e9 / (double)SDL_GetPerformanceFrequency();
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "Usage: %s [--frames N] [--delta SECONDS] [--seed S] [--width W] [--height H]\n"
+            "          [--density COLUMNS_PER_100PX] [--char-width W] [--char-height H]\n"
+            "          [--lightning N] [--columns N] [--max-columns N] [--threads N]\n"
+            "          [--lightning-detail N] [--gusts R] [--splash N] [--particles N]\n"
+            "          [--check 0|1]\n",
+            prog);
+}
+
+/* Parse command line options; returns false on an unknown or incomplete option */
+static bool parse_args(int argc, char *argv[], BenchConfig *cfg) {
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        if (i + 1 >= argc) return false;
+        const char *val = argv[++i];
+        if (strcmp(opt, "--frames") == 0) cfg->frames = atoi(val);
+        else if (strcmp(opt, "--delta") == 0) cfg->delta = (float)atof(val);
+        else if (strcmp(opt, "--seed") == 0) cfg->seed = (unsigned)strtoul(val, NULL, 10);
+        else if (strcmp(opt, "--width") == 0) cfg->width = atoi(val);
+        else if (strcmp(opt, "--height") == 0) cfg->height = atoi(val);
+        else if (strcmp(opt, "--density") == 0) cfg->density = (float)atof(val);
+        else if (strcmp(opt, "--char-width") == 0) cfg->char_width = atoi(val);
+        else if (strcmp(opt, "--char-height") == 0) cfg->char_height = atoi(val);
+        else if (strcmp(opt, "--lightning") == 0) cfg->lightning_runs = atoi(val);
+        else if (strcmp(opt, "--columns") == 0) cfg->initial_columns = atoi(val);
+        else if (strcmp(opt, "--max-columns") == 0) cfg->max_columns = atoi(val);
+        else if (strcmp(opt, "--threads") == 0) cfg->threads = atoi(val);
+        else if (strcmp(opt, "--lightning-detail") == 0) cfg->lightning_detail = atoi(val);
+        else if (strcmp(opt, "--gusts") == 0) cfg->gusts = (float)atof(val);
+        else if (strcmp(opt, "--splash") == 0) cfg->splash = atoi(val);
+        else if (strcmp(opt, "--particles") == 0) cfg->stress_particles = atoi(val);
+        else if (strcmp(opt, "--check") == 0) cfg->check = atoi(val);
+        else return false;
+    }
+    return cfg->frames > 0 && cfg->delta > 0.0f && cfg->width > 0 && cfg->height > 0 &&
+           cfg->char_width > 0 && cfg->char_height > 0 && cfg->lightning_runs >= 0 &&
+           cfg->density >= 0.0f && cfg->initial_columns >= 0 && cfg->max_columns > 0 &&
+           cfg->threads >= 0 && cfg->gusts >= 0.0f && cfg->splash >= 0 &&
+           cfg->stress_particles >= 0 && cfg->stress_particles <= PARTICLE_CAPACITY &&
+           cfg->lightning_detail >= 0 && cfg->lightning_detail <= LIGHTNING_MAX_DETAIL;
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig cfg = {
+        .frames = 3600,
+        .delta = SIM_STEP,
+        .seed = 1,
+        .width = 1920,
+        .height = 1080,
+        .density = 3.0f,
+        .char_width = 16,
+        .char_height = 23,
+        .lightning_runs = 1000,
+        .initial_columns = 0,
+        .max_columns = COLUMN_CAP_DEFAULT,
+        .threads = 1,
+        .gusts = WIND_GUST_RATE_DEFAULT,
+        .splash = SPLASH_FRAGMENTS_DEFAULT,
+        .stress_particles = 100000,
+    };
+    if (!parse_args(argc, argv, &cfg)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    storm_seed(cfg.seed);
+    g_screen_width = cfg.width;
+    g_screen_height = cfg.height;
+    char_width = cfg.char_width;
+    char_height = cfg.char_height;
+    column_density = cfg.density;
+    column_cap = cfg.max_columns;
+    wind_gust_rate = cfg.gusts;
+    splash_fragments = cfg.splash;
+    if (!reserve_columns(column_cap)) {
+        fprintf(stderr, "Failed to allocate column pool.\n");
+        return 1;
+    }
+    lightning_detail = cfg.lightning_detail;
+    if (!reserve_lightning()) {
+        fprintf(stderr, "Failed to allocate lightning pool.\n");
+        return 1;
+    }
+    if (!reserve_particles()) {
+        fprintf(stderr, "Failed to allocate particle pool.\n");
+        return 1;
+    }
+    if (!particles.x) cfg.stress_particles = 0;  /* No pool with --splash 0 */
+    glyph_ghost_alpha = 0.15f;  /* Emit the analytic-mode ghosts too, so both trail modes can be costed */
+    pool_init(cfg.threads);
+
+    /* Optional pre-filled storm, spread over the whole spawn range */
+    int margin = char_height * column_margin_chars;
+    for (int i = 0; i < cfg.initial_columns; i++) {
+        int c = create_column((int)rng_range(&rng_columns, g_screen_width + 2 * margin) - margin);
+        if (c >= 0)
+            columns.y[c] = (float)rng_range(&rng_columns, g_screen_height + margin) - margin;
+    }
+
+    /* Simulation: the same update sequence as main_loop(), minus rendering */
+    unsigned long allocations_before = sim_allocations;
+    size_t peak_columns = 0;
+    double column_ns = 0.0, wind_ns = 0.0, particle_ns = 0.0;
+    unsigned long long live_particles = 0, particle_updates = 0;
+    size_t peak_particles = 0;
+    unsigned long long wind_features = 0;
+    unsigned long long column_updates = 0;
+    GlyphFill fill = { 0 };
+    double fill_ns = 0.0;
+
+    Uint64 sim_start = SDL_GetPerformanceCounter();
+    for (int frame = 0; frame < cfg.frames; frame++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        update_wind(cfg.delta);
+        Uint64 t1 = SDL_GetPerformanceCounter();
+        wind_ns += elapsed_ns(t0, t1);
+        wind_features += wind_feature_count();
+
+        size_t updated = columns.count;
+        t0 = SDL_GetPerformanceCounter();
+        update_columns(cfg.delta);
+        t1 = SDL_GetPerformanceCounter();
+        column_ns += elapsed_ns(t0, t1);
+        column_updates += updated;
+        if (columns.count > peak_columns)
+            peak_columns = columns.count;
+
+        update_lightning(cfg.delta);
+
+        updated = particles.count;
+        unsigned long long emitted = particles.emitted;
+        t0 = SDL_GetPerformanceCounter();
+        update_particles(cfg.delta);
+        t1 = SDL_GetPerformanceCounter();
+        particle_ns += elapsed_ns(t0, t1);
+        particle_updates += updated;
+        if (cfg.check) check_particles(frame, updated, emitted);
+        live_particles += particles.count;
+        if (particles.count > peak_particles)
+            peak_particles = particles.count;
+
+        /* Fill-rate accounting is not part of the simulation timings */
+        t0 = SDL_GetPerformanceCounter();
+        count_glyph_fill(&fill);
+        fill_ns += elapsed_ns(t0, SDL_GetPerformanceCounter());
+    }
+    Uint64 sim_end = SDL_GetPerformanceCounter();
+    uint64_t digest = state_digest();
+    unsigned long step_allocations = sim_allocations - allocations_before;
+    double sim_ns = elapsed_ns(sim_start, sim_end) - fill_ns;
+    unsigned long long particles_emitted = particles.emitted, particles_dropped = particles.dropped;
+
+    /* Splash particles at load: the pool is topped up to stress_particles
+     * with bursts spread over the screen before every step, and the steps
+     * alone are timed */
+    double stress_ns = 0.0, stress_emit_ns = 0.0;
+    unsigned long long stress_updates = 0;
+    int stress_frames = cfg.stress_particles > 0 ? cfg.frames : 0;
+    for (int frame = 0; frame < stress_frames; frame++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        while (particles.count < (size_t)cfg.stress_particles) {
+            emit_splash((float)rng_range(&rng_splash, g_screen_width),
+                        (float)rng_range(&rng_splash, g_screen_height), 0.0f, -200.0f, 200.0f, 16,
+                        (int)rng_range(&rng_splash, NUM_UNICODE_CHARS), (SDL_Color){ 0, 200, 0, 255 });
+        }
+        Uint64 t1 = SDL_GetPerformanceCounter();
+        stress_emit_ns += elapsed_ns(t0, t1);
+        size_t updated = particles.count;
+        unsigned long long emitted = particles.emitted;
+        stress_updates += updated;
+        update_particles(cfg.delta);
+        stress_ns += elapsed_ns(t1, SDL_GetPerformanceCounter());
+        if (cfg.check) check_particles(cfg.frames + frame, updated, emitted);
+    }
+
+    /* Wind field lookups as the scalar column kernel makes them, at the
+     * center of every glyph cell of the screen */
+    unsigned long long wind_samples = 0;
+    double wind_gain = 0.0;
+    Uint64 w0 = SDL_GetPerformanceCounter();
+    for (int y = char_height / 2; y < g_screen_height; y += char_height) {
+        for (int x = char_width / 2; x < g_screen_width; x += char_width) {
+            float slope, gain;
+            wind_field_at((float)x, (float)y, &slope, &gain);
+            wind_gain += gain;
+            wind_samples++;
+        }
+    }
+    double wind_sample_ns = elapsed_ns(w0, SDL_GetPerformanceCounter());
+
+    /* Pixels written per frame by each trail mode: the canvas mode blends a
+     * full-screen fade into the canvas, draws the glyphs and copies the canvas
+     * to the screen; the analytic mode clears the screen and draws the glyphs
+     * plus one ghost per column */
+    double screen_pixels = (double)cfg.width * cfg.height;
+    double canvas_fill = 2.0 * screen_pixels + fill.glyph_pixels / cfg.frames;
+    double analytic_fill = screen_pixels + (fill.glyph_pixels + fill.ghost_pixels) / cfg.frames;
+
+    /* Lightning: bolt generation including its mesh, then the per-frame fade
+     * of that mesh over the bolt's lifetime */
+    double lightning_ns = 0.0, fade_ns = 0.0;
+    unsigned long long mesh_vertices = 0, fade_frames = 0;
+
+    clear_lightning();
+    allocations_before = sim_allocations;
+    for (int run = 0; run < cfg.lightning_runs; run++) {
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        LightningEffect *l = spawn_lightning_of_type(0);
+        Uint64 t1 = SDL_GetPerformanceCounter();
+        lightning_ns += elapsed_ns(t0, t1);
+        if (!l) continue;
+        mesh_vertices += l->num_vertices;
+
+        t0 = SDL_GetPerformanceCounter();
+        for (; l->timer > 0.0f && l->num_vertices > 0; l->timer -= cfg.delta) {
+            fade_lightning_mesh(l);
+            fade_frames++;
+        }
+        t1 = SDL_GetPerformanceCounter();
+        fade_ns += elapsed_ns(t0, t1);
+
+        release_lightning(l);
+    }
+    unsigned long lightning_allocations = sim_allocations - allocations_before;
+
+    /* Per-frame batching as drawn by draw_lightning(), with one bolt live and
+     * with every slot taken */
+    double batch_ns[2] = { 0.0, 0.0 };
+    for (int full = 0; full < 2; full++) {
+        for (int i = 0; i < (full ? LIGHTNING_SLOTS : 1); i++)
+            spawn_lightning_of_type(0);
+        Uint64 t0 = SDL_GetPerformanceCounter();
+        for (int run = 0; run < cfg.lightning_runs; run++)
+            batch_lightning();
+        batch_ns[full] = elapsed_ns(t0, SDL_GetPerformanceCounter());
+        clear_lightning();
+    }
+
+    /* Illumination with every slot holding a bolt: building the light grid,
+     * then lighting the center of every glyph cell of the screen through
+     * the grid and, for a sample of them, by testing every segment */
+    for (int i = 0; i < LIGHTNING_SLOTS; i++)
+        spawn_lightning_of_type(0);
+    Uint64 l0 = SDL_GetPerformanceCounter();
+    prepare_lightning_light();
+    double light_build_ns = elapsed_ns(l0, SDL_GetPerformanceCounter());
+    unsigned long long light_queries = 0, lit_points = 0, brute_queries = 0;
+    double light_ns = 0.0, brute_ns = 0.0, light_error = 0.0;
+    for (int y = char_height / 2; y < g_screen_height; y += char_height) {
+        l0 = SDL_GetPerformanceCounter();
+        for (int x = char_width / 2; x < g_screen_width; x += char_width) {
+            lit_points += lightning_light_at((float)x, (float)y) > 0.0f;
+            light_queries++;
+        }
+        light_ns += elapsed_ns(l0, SDL_GetPerformanceCounter());
+    }
+    for (int y = char_height / 2; y < g_screen_height; y += 8 * char_height) {
+        for (int x = char_width / 2; x < g_screen_width; x += char_width) {
+            l0 = SDL_GetPerformanceCounter();
+            float expected = brute_force_light((float)x, (float)y);
+            brute_ns += elapsed_ns(l0, SDL_GetPerformanceCounter());
+            light_error = fmax(light_error, fabs(expected - lightning_light_at((float)x, (float)y)));
+            brute_queries++;
+        }
+    }
+    clear_lightning();
+    if (cfg.check && light_error > CHECK_LIGHT_ERROR)
+        check_failed(cfg.frames, "light grid differs from the brute force reference", 0);
+
+    /* Fractal generator on its own: a main channel at the bolt's detail level
+     * into a buffer allocated up front */
+    int detail = lightning_bolt_detail();
+    SDL_FPoint *fractal = malloc(LIGHTNING_POINT_COUNT(detail) * sizeof(SDL_FPoint));
+    if (!fractal) {
+        fprintf(stderr, "Failed to allocate fractal buffer.\n");
+        return 1;
+    }
+    unsigned long long fractal_points = 0;
+    Uint64 f0 = SDL_GetPerformanceCounter();
+    for (int run = 0; run < cfg.lightning_runs; run++) {
+        fractal_points += generate_fractal_lightning_points(fractal, 0.0f, 0.0f, g_screen_width / 2.0f,
+                                                            g_screen_height * 0.85f, g_screen_width / 8.0f, detail);
+    }
+    double fractal_ns = elapsed_ns(f0, SDL_GetPerformanceCounter());
+    free(fractal);
+
+    int runs = cfg.lightning_runs > 0 ? cfg.lightning_runs : 1;
+    printf("{\n");
+    printf("  \"kernel\": \"%s\",\n", column_kernel_name);
+    printf("  \"threads\": %d,\n", pool_worker_count());
+    printf("  \"frames\": %d,\n", cfg.frames);
+    printf("  \"delta\": %g,\n", cfg.delta);
+    printf("  \"seed\": %u,\n", cfg.seed);
+    printf("  \"width\": %d,\n", cfg.width);
+    printf("  \"height\": %d,\n", cfg.height);
+    printf("  \"density\": %g,\n", cfg.density);
+    printf("  \"max_columns\": %d,\n", column_cap);
+    printf("  \"frames_per_second\": %.1f,\n", cfg.frames * 1e9 / sim_ns);
+    printf("  \"ns_per_column_update\": %.2f,\n", column_updates ? column_ns / column_updates : 0.0);
+    printf("  \"ns_per_wind_update\": %.1f,\n", wind_ns / cfg.frames);
+    printf("  \"ns_per_wind_sample\": %.2f,\n", wind_samples ? wind_sample_ns / wind_samples : 0.0);
+    printf("  \"wind_features_per_frame\": %.2f,\n", (double)wind_features / cfg.frames);
+    printf("  \"wind_mean_gain\": %.3f,\n", wind_samples ? wind_gain / wind_samples : 0.0);
+    printf("  \"particles_per_frame\": %.1f,\n", (double)live_particles / cfg.frames);
+    printf("  \"peak_particles\": %zu,\n", peak_particles);
+    printf("  \"particles_emitted_per_frame\": %.1f,\n", (double)particles_emitted / cfg.frames);
+    printf("  \"particles_dropped\": %llu,\n", particles_dropped);
+    printf("  \"ns_per_particle_update\": %.2f,\n", particle_updates ? particle_ns / particle_updates : 0.0);
+    printf("  \"stress_particles\": %d,\n", cfg.stress_particles);
+    printf("  \"ns_per_particle_update_stress\": %.2f,\n", stress_updates ? stress_ns / stress_updates : 0.0);
+    printf("  \"ms_per_particle_step_stress\": %.3f,\n", stress_frames ? stress_ns / stress_frames / 1e6 : 0.0);
+    printf("  \"ns_per_particle_emit_stress\": %.2f,\n",
+           particles.emitted > particles_emitted ? stress_emit_ns / (particles.emitted - particles_emitted) : 0.0);
+    printf("  \"ns_per_lightning_generation\": %.1f,\n", lightning_ns / runs);
+    printf("  \"lightning_detail\": %d,\n", detail);
+    printf("  \"ns_per_fractal_point\": %.2f,\n", fractal_points ? fractal_ns / fractal_points : 0.0);
+    printf("  \"ns_per_lightning_fade\": %.1f,\n", fade_frames ? fade_ns / fade_frames : 0.0);
+    printf("  \"lightning_vertices\": %.1f,\n", (double)mesh_vertices / runs);
+    printf("  \"ns_per_lightning_batch_1\": %.1f,\n", batch_ns[0] / runs);
+    printf("  \"ns_per_lightning_batch_%d\": %.1f,\n", LIGHTNING_SLOTS, batch_ns[1] / runs);
+    printf("  \"ns_per_light_grid_build_%d\": %.1f,\n", LIGHTNING_SLOTS, light_build_ns);
+    printf("  \"ns_per_light_query\": %.2f,\n", light_queries ? light_ns / light_queries : 0.0);
+    printf("  \"ns_per_light_query_brute_force\": %.2f,\n", brute_queries ? brute_ns / brute_queries : 0.0);
+    printf("  \"light_lit_fraction\": %.3f,\n", light_queries ? (double)lit_points / light_queries : 0.0);
+    printf("  \"light_max_error\": %.2g,\n", light_error);
+    printf("  \"glyphs_drawn_per_frame\": %.1f,\n", (double)fill.glyphs_drawn / cfg.frames);
+    printf("  \"glyphs_culled_per_frame\": %.1f,\n", (double)fill.glyphs_culled / cfg.frames);
+    printf("  \"fragments_drawn_per_frame\": %.1f,\n", (double)fill.fragments_drawn / cfg.frames);
+    printf("  \"columns_drawn_per_frame\": %.1f,\n", (double)fill.columns_drawn / cfg.frames);
+    printf("  \"columns_culled_per_frame\": %.1f,\n", (double)fill.columns_culled / cfg.frames);
+    printf("  \"canvas_trail_pixels_per_frame\": %.0f,\n", canvas_fill);
+    printf("  \"analytic_trail_pixels_per_frame\": %.0f,\n", analytic_fill);
+    printf("  \"analytic_trail_fill_ratio\": %.3f,\n", analytic_fill / canvas_fill);
+    printf("  \"peak_columns\": %zu,\n", peak_columns);
+    printf("  \"final_columns\": %zu,\n", columns.count);
+    printf("  \"simulation_allocations\": %lu,\n", step_allocations);
+    printf("  \"lightning_allocations\": %lu,\n", lightning_allocations);
+    printf("  \"state_digest\": \"%016llx\"\n", (unsigned long long)digest);
+    printf("}\n");
+
+    free_columns();
+    free_lightning();
+    free_wind();
+    free_particles();
+    pool_shutdown();
+    if (check_failures > 0) {
+        fprintf(stderr, "%lu checks failed\n", check_failures);
+        return 1;
+    }
+    return 0;
+}
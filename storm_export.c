@@ -0,0 +1,241 @@
+/*
+ * storm_export.c
+ *
+ * Frame export with a background writer.  See storm_export.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+
+#ifdef _WIN32
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define fdopen _fdopen
+#define fileno _fileno
+#else
+#include <unistd.h>
+#endif
+
+#include "storm_export.h"
+
+typedef struct {
+    unsigned char *pixels;
+    bool bottom_up;
+} ExportSlot;
+
+static struct {
+    FILE *out;
+    bool close_out;           /* out was opened by export_open() */
+    int width, height;
+    ExportFormat format;
+    unsigned char *yuv;       /* Writer's conversion buffer for Y4M */
+
+    SDL_Thread *thread;
+    SDL_mutex *lock;
+    SDL_cond *filled;         /* Signaled when a frame is submitted or on close */
+    SDL_cond *drained;        /* Signaled when the writer frees a buffer */
+    ExportSlot slots[EXPORT_SLOTS];
+    unsigned long long submitted;  /* Frames handed to the writer */
+    unsigned long long written;    /* Frames the writer is done with */
+    bool closing;
+
+    ExportStats stats;
+} ex;
+
+static double seconds_since(Uint64 counter) {
+    return (double)(SDL_GetPerformanceCounter() - counter) / SDL_GetPerformanceFrequency();
+}
+
+static bool write_bytes(const void *data, size_t size) {
+    if (ex.stats.write_error) return false;
+    if (fwrite(data, 1, size, ex.out) != size) {
+        ex.stats.write_error = true;
+        return false;
+    }
+    ex.stats.bytes += size;
+    return true;
+}
+
+/* BT.601 limited-range conversion, 8-bit fixed point */
+static inline unsigned char luma(int r, int g, int b) {
+    return (unsigned char)(16 + ((66 * r + 129 * g + 25 * b + 128) >> 8));
+}
+
+/* Convert a frame to planar 4:2:0; each chroma sample averages a 2x2 block */
+static void convert_yuv420(const ExportSlot *slot) {
+    int w = ex.width, h = ex.height;
+    int cw = (w + 1) / 2, ch = (h + 1) / 2;
+    unsigned char *y_plane = ex.yuv;
+    unsigned char *u_plane = y_plane + (size_t)w * h;
+    unsigned char *v_plane = u_plane + (size_t)cw * ch;
+
+    for (int y = 0; y < h; y++) {
+        int src_row = slot->bottom_up ? h - 1 - y : y;
+        const unsigned char *p = slot->pixels + (size_t)src_row * w * 4;
+        unsigned char *dst = y_plane + (size_t)y * w;
+        for (int x = 0; x < w; x++, p += 4)
+            dst[x] = luma(p[0], p[1], p[2]);
+    }
+
+    for (int cy = 0; cy < ch; cy++) {
+        int y0 = 2 * cy, y1 = y0 + 1 < h ? y0 + 1 : y0;
+        if (slot->bottom_up) {
+            y0 = h - 1 - y0;
+            y1 = h - 1 - y1;
+        }
+        const unsigned char *row0 = slot->pixels + (size_t)y0 * w * 4;
+        const unsigned char *row1 = slot->pixels + (size_t)y1 * w * 4;
+        for (int cx = 0; cx < cw; cx++) {
+            int x0 = 2 * cx * 4, x1 = 2 * cx + 1 < w ? x0 + 4 : x0;
+            int r = row0[x0] + row0[x1] + row1[x0] + row1[x1];
+            int g = row0[x0 + 1] + row0[x1 + 1] + row1[x0 + 1] + row1[x1 + 1];
+            int b = row0[x0 + 2] + row0[x1 + 2] + row1[x0 + 2] + row1[x1 + 2];
+            /* The sums carry two extra bits, folded into the shift */
+            u_plane[(size_t)cy * cw + cx] = (unsigned char)(128 + ((-38 * r - 74 * g + 112 * b + 512) >> 10));
+            v_plane[(size_t)cy * cw + cx] = (unsigned char)(128 + ((112 * r - 94 * g - 18 * b + 512) >> 10));
+        }
+    }
+}
+
+static void write_frame(const ExportSlot *slot) {
+    size_t row_bytes = (size_t)ex.width * 4;
+    if (ex.format == EXPORT_Y4M) {
+        convert_yuv420(slot);
+        size_t size = (size_t)ex.width * ex.height + 2 * (size_t)((ex.width + 1) / 2) * ((ex.height + 1) / 2);
+        if (write_bytes("FRAME\n", 6))
+            write_bytes(ex.yuv, size);
+    } else if (!slot->bottom_up) {
+        write_bytes(slot->pixels, row_bytes * ex.height);
+    } else {
+        for (int y = ex.height - 1; y >= 0; y--)
+            write_bytes(slot->pixels + (size_t)y * row_bytes, row_bytes);
+    }
+}
+
+static int writer_main(void *arg) {
+    (void)arg;
+    SDL_LockMutex(ex.lock);
+    for (;;) {
+        while (!ex.closing && ex.written == ex.submitted)
+            SDL_CondWait(ex.filled, ex.lock);
+        if (ex.written == ex.submitted)
+            break;  /* Closing and nothing left */
+        ExportSlot *slot = &ex.slots[ex.written % EXPORT_SLOTS];
+        SDL_UnlockMutex(ex.lock);
+
+        Uint64 start = SDL_GetPerformanceCounter();
+        write_frame(slot);
+        ex.stats.write_seconds += seconds_since(start);
+
+        SDL_LockMutex(ex.lock);
+        ex.written++;
+        SDL_CondSignal(ex.drained);
+    }
+    SDL_UnlockMutex(ex.lock);
+    fflush(ex.out);
+    return 0;
+}
+
+bool export_open(const char *path, int width, int height, int fps, ExportFormat format) {
+    memset(&ex, 0, sizeof(ex));
+    ex.width = width;
+    ex.height = height;
+    ex.format = format;
+
+    if (strcmp(path, "-") == 0) {
+        /* Keep the real stdout for frames and send everything printed to stderr */
+        fflush(stdout);
+        int fd = dup(fileno(stdout));
+        ex.out = fd >= 0 ? fdopen(fd, "wb") : NULL;
+        if (ex.out) dup2(fileno(stderr), fileno(stdout));
+    } else {
+        ex.out = fopen(path, "wb");
+    }
+    if (!ex.out) {
+        printf("Cannot open export output '%s'\n", path);
+        return false;
+    }
+    ex.close_out = true;
+
+    size_t frame_bytes = (size_t)width * height * 4;
+    for (int i = 0; i < EXPORT_SLOTS; i++) {
+        ex.slots[i].pixels = malloc(frame_bytes);
+        if (!ex.slots[i].pixels) goto fail;
+    }
+    if (format == EXPORT_Y4M) {
+        ex.yuv = malloc((size_t)width * height + 2 * (size_t)((width + 1) / 2) * ((height + 1) / 2));
+        if (!ex.yuv) goto fail;
+        char header[128];
+        int n = snprintf(header, sizeof(header), "YUV4MPEG2 W%d H%d F%d:1 Ip A1:1 C420jpeg\n", width, height, fps);
+        if (!write_bytes(header, (size_t)n)) goto fail;
+    }
+
+    ex.lock = SDL_CreateMutex();
+    ex.filled = SDL_CreateCond();
+    ex.drained = SDL_CreateCond();
+    if (!ex.lock || !ex.filled || !ex.drained) goto fail;
+    ex.thread = SDL_CreateThread(writer_main, "storm export", NULL);
+    if (!ex.thread) {
+        printf("Failed to start the export writer: %s\n", SDL_GetError());
+        goto fail;
+    }
+    return true;
+
+fail:
+    printf("Export setup failed\n");
+    export_close(NULL);
+    return false;
+}
+
+unsigned char *export_acquire(void) {
+    Uint64 start = SDL_GetPerformanceCounter();
+    SDL_LockMutex(ex.lock);
+    while (ex.submitted - ex.written == EXPORT_SLOTS)
+        SDL_CondWait(ex.drained, ex.lock);
+    SDL_UnlockMutex(ex.lock);
+    ex.stats.render_wait_seconds += seconds_since(start);
+    return ex.slots[ex.submitted % EXPORT_SLOTS].pixels;
+}
+
+void export_submit(bool bottom_up) {
+    SDL_LockMutex(ex.lock);
+    ex.slots[ex.submitted % EXPORT_SLOTS].bottom_up = bottom_up;
+    ex.submitted++;
+    SDL_CondSignal(ex.filled);
+    SDL_UnlockMutex(ex.lock);
+}
+
+bool export_close(ExportStats *stats) {
+    if (ex.thread) {
+        SDL_LockMutex(ex.lock);
+        ex.closing = true;
+        SDL_CondSignal(ex.filled);
+        SDL_UnlockMutex(ex.lock);
+        SDL_WaitThread(ex.thread, NULL);
+        ex.thread = NULL;
+    }
+    ex.stats.frames = ex.written;
+    if (ex.close_out && fclose(ex.out) != 0)
+        ex.stats.write_error = true;
+    ex.out = NULL;
+    ex.close_out = false;
+
+    if (ex.drained) SDL_DestroyCond(ex.drained);
+    if (ex.filled) SDL_DestroyCond(ex.filled);
+    if (ex.lock) SDL_DestroyMutex(ex.lock);
+    ex.drained = ex.filled = NULL;
+    ex.lock = NULL;
+    for (int i = 0; i < EXPORT_SLOTS; i++) {
+        free(ex.slots[i].pixels);
+        ex.slots[i].pixels = NULL;
+    }
+    free(ex.yuv);
+    ex.yuv = NULL;
+
+    if (stats) *stats = ex.stats;
+    return !ex.stats.write_error;
+}
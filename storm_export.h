@@ -0,0 +1,54 @@
+/*
+ * storm_export.h
+ *
+ * Frame export for offline rendering.  Composited frames are handed to a
+ * writer thread that converts and streams them while the next frame renders.
+ * Two frame buffers circulate between the renderer and the writer: the
+ * renderer fills one while the writer drains the other, and only waits when
+ * the writer falls a full frame behind.
+ *
+ * Output is either raw RGBA (8 bits per channel, top row first) or Y4M with
+ * 4:2:0 BT.601 limited-range YUV, both ready to pipe into an encoder.
+ */
+
+#ifndef STORM_EXPORT_H
+#define STORM_EXPORT_H
+
+#include <stdbool.h>
+
+/* Frame buffers shared between the renderer and the writer */
+#define EXPORT_SLOTS 2
+
+typedef enum {
+    EXPORT_RGBA,
+    EXPORT_Y4M,
+} ExportFormat;
+
+/* Totals of an export, from export_close() */
+typedef struct {
+    unsigned long long frames;
+    unsigned long long bytes;     /* Bytes written, headers included */
+    double render_wait_seconds;   /* Time the renderer spent waiting for a free buffer */
+    double write_seconds;         /* Time the writer spent converting and writing */
+    bool write_error;             /* Output failed; frames after the error were dropped */
+} ExportStats;
+
+/* Start exporting width x height frames at fps frames/s to path, "-" being
+ * stdout.  Writing to stdout moves the process's own stdout to stderr, so
+ * log messages cannot corrupt the stream; open the export before printing
+ * anything.
+ */
+bool export_open(const char *path, int width, int height, int fps, ExportFormat format);
+
+/* Buffer for the next frame, width * height RGBA pixels; waits while both
+ * buffers are in use */
+unsigned char *export_acquire(void);
+
+/* Queue the buffer from export_acquire(); bottom_up says its rows are stored
+ * bottom row first, as GL reads them back */
+void export_submit(bool bottom_up);
+
+/* Write the queued frames, stop the writer and close the output */
+bool export_close(ExportStats *stats);
+
+#endif /* STORM_EXPORT_H */
@@ -0,0 +1,155 @@
+/*
+ * storm_governor.c
+ *
+ * Frame-time budget governor.  See storm_governor.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "storm_governor.h"
+#include "storm_sim.h"
+
+/* Frames between two evaluations of the percentile */
+#define GOVERNOR_EVAL_FRAMES 30
+
+/* Hysteresis: the tracked percentile must be above target * DOWN_RATIO for
+ * DOWN_EVALS evaluations in a row before quality drops, and below
+ * target * UP_RATIO for UP_EVALS evaluations before it rises again */
+#define GOVERNOR_DOWN_RATIO 1.0f
+#define GOVERNOR_DOWN_EVALS 2
+#define GOVERNOR_UP_RATIO 0.7f
+#define GOVERNOR_UP_EVALS 4
+
+/* Load caps of each tier; tier 0 is unrestricted and uses the baseline */
+static const GovernorTier tier_caps[GOVERNOR_NUM_TIERS] = {
+    { 0.0f,  0,  0.0f,  0 },
+    { 2.25f, 30, 0.15f, 6 },
+    { 1.5f,  15, 0.25f, 5 },
+    { 0.9f,  8,  0.40f, 4 },
+};
+
+static struct {
+    bool enabled;
+    GovernorTier baseline;    /* Settings when the governor started */
+    int tier;
+    int max_tier;
+    float target_ms;
+    float window[GOVERNOR_WINDOW];  /* Frame times in ms, ring buffer */
+    int window_count;
+    int window_next;
+    int over_evals, under_evals;    /* Consecutive evaluations past a threshold */
+    float percentile_ms;
+    unsigned long long frames;
+    int num_decisions;
+    GovernorDecision history[GOVERNOR_HISTORY];  /* Ring buffer of tier changes */
+} gov;
+
+/* Tracked percentile of the frame time */
+static const float governor_percentile = 0.9f;
+
+/* Settings of a tier: the baseline, capped by the tier's limits */
+static GovernorTier tier_settings(int tier) {
+    GovernorTier t = gov.baseline;
+    if (tier == 0) return t;
+    const GovernorTier *cap = &tier_caps[tier];
+    if (t.density > cap->density) t.density = cap->density;
+    if (t.margin_chars > cap->margin_chars) t.margin_chars = cap->margin_chars;
+    if (t.glyph_interval < cap->glyph_interval) t.glyph_interval = cap->glyph_interval;
+    /* The automatic detail is never below the first cap, so capping it means using the cap */
+    if (t.lightning_detail == 0 || t.lightning_detail > cap->lightning_detail)
+        t.lightning_detail = cap->lightning_detail;
+    return t;
+}
+
+static void apply_tier(int tier) {
+    GovernorTier t = tier_settings(tier);
+    column_density = t.density;
+    column_margin_chars = t.margin_chars;
+    glyph_update_interval = t.glyph_interval;
+    lightning_detail = t.lightning_detail;
+}
+
+static int compare_floats(const void *a, const void *b) {
+    float fa = *(const float *)a, fb = *(const float *)b;
+    return (fa > fb) - (fa < fb);
+}
+
+/* Percentile of the frame-time window in ms */
+static float window_percentile(void) {
+    float sorted[GOVERNOR_WINDOW];
+    memcpy(sorted, gov.window, gov.window_count * sizeof(float));
+    qsort(sorted, gov.window_count, sizeof(float), compare_floats);
+    int rank = (int)(governor_percentile * (gov.window_count - 1) + 0.5f);
+    return sorted[rank];
+}
+
+static void change_tier(int tier) {
+    GovernorDecision *d = &gov.history[gov.num_decisions % GOVERNOR_HISTORY];
+    d->frame = gov.frames;
+    d->from_tier = gov.tier;
+    d->to_tier = tier;
+    d->percentile_ms = gov.percentile_ms;
+    gov.num_decisions++;
+    printf("Governor: tier %d -> %d (p%d frame time %.1f ms, target %.1f ms)\n",
+           gov.tier, tier, (int)(governor_percentile * 100), gov.percentile_ms, gov.target_ms);
+
+    gov.tier = tier;
+    apply_tier(tier);
+    /* Judge the new tier on its own frames only */
+    gov.window_count = 0;
+    gov.window_next = 0;
+    gov.over_evals = 0;
+    gov.under_evals = 0;
+}
+
+void governor_init(float target_ms, int max_tier) {
+    memset(&gov, 0, sizeof(gov));
+    gov.enabled = true;
+    gov.baseline.density = column_density;
+    gov.baseline.margin_chars = column_margin_chars;
+    gov.baseline.glyph_interval = glyph_update_interval;
+    gov.baseline.lightning_detail = lightning_detail;
+    gov.target_ms = target_ms;
+    if (max_tier < 0) max_tier = 0;
+    if (max_tier >= GOVERNOR_NUM_TIERS) max_tier = GOVERNOR_NUM_TIERS - 1;
+    gov.max_tier = max_tier;
+}
+
+void governor_frame(double frame_seconds) {
+    if (!gov.enabled) return;
+    gov.frames++;
+    gov.window[gov.window_next] = (float)(frame_seconds * 1000.0);
+    gov.window_next = (gov.window_next + 1) % GOVERNOR_WINDOW;
+    if (gov.window_count < GOVERNOR_WINDOW) gov.window_count++;
+
+    if (gov.window_count < GOVERNOR_WINDOW || gov.frames % GOVERNOR_EVAL_FRAMES != 0)
+        return;
+
+    gov.percentile_ms = window_percentile();
+    gov.over_evals = gov.percentile_ms > gov.target_ms * GOVERNOR_DOWN_RATIO ? gov.over_evals + 1 : 0;
+    gov.under_evals = gov.percentile_ms < gov.target_ms * GOVERNOR_UP_RATIO ? gov.under_evals + 1 : 0;
+
+    if (gov.over_evals >= GOVERNOR_DOWN_EVALS && gov.tier < gov.max_tier) {
+        change_tier(gov.tier + 1);
+    } else if (gov.under_evals >= GOVERNOR_UP_EVALS && gov.tier > 0) {
+        change_tier(gov.tier - 1);
+    }
+}
+
+void governor_status(GovernorStatus *status) {
+    status->enabled = gov.enabled;
+    status->tier = gov.tier;
+    status->max_tier = gov.max_tier;
+    status->target_ms = gov.target_ms;
+    status->percentile = governor_percentile;
+    status->percentile_ms = gov.percentile_ms;
+    status->frames = gov.frames;
+    status->num_decisions = gov.num_decisions;
+    status->num_recent = gov.num_decisions < GOVERNOR_HISTORY ? gov.num_decisions : GOVERNOR_HISTORY;
+    for (int i = 0; i < status->num_recent; i++) {
+        status->recent[i] = gov.history[(gov.num_decisions - 1 - i) % GOVERNOR_HISTORY];
+    }
+    status->settings = tier_settings(gov.tier);
+}
@@ -0,0 +1,66 @@
+/*
+ * storm_governor.h
+ *
+ * Frame-time budget governor.  Tracks a rolling percentile of the frame
+ * time and moves the simulation between quality tiers: column density,
+ * off-screen retention margin, glyph mutation rate and lightning detail.
+ * Tier 0 is the configuration the governor started from; higher tiers only
+ * ever lower the load.  Changes need the percentile to stay past a threshold
+ * for several evaluations in a row, so quality does not oscillate.
+ */
+
+#ifndef STORM_GOVERNOR_H
+#define STORM_GOVERNOR_H
+
+#include <stdbool.h>
+
+/* Number of quality tiers, 0 being full quality */
+#define GOVERNOR_NUM_TIERS 4
+
+/* Frame times kept for the rolling percentile */
+#define GOVERNOR_WINDOW 120
+
+/* Number of past tier changes kept for governor_status() */
+#define GOVERNOR_HISTORY 8
+
+/* Simulation settings of one tier */
+typedef struct {
+    float density;            /* column_density */
+    int margin_chars;         /* column_margin_chars */
+    float glyph_interval;     /* glyph_update_interval */
+    int lightning_detail;     /* lightning_detail; 0 = from screen height */
+} GovernorTier;
+
+/* One tier change */
+typedef struct {
+    unsigned long long frame; /* Frame at which the change was made */
+    int from_tier, to_tier;
+    float percentile_ms;      /* Frame-time percentile that triggered it */
+} GovernorDecision;
+
+/* Snapshot of the governor for HUDs and logs */
+typedef struct {
+    bool enabled;
+    int tier;                 /* Current tier */
+    int max_tier;             /* Lowest quality the governor may choose */
+    float target_ms;          /* Frame time budget */
+    float percentile;         /* Which percentile is tracked, e.g. 0.9 */
+    float percentile_ms;      /* Last evaluated frame-time percentile; 0 before the first */
+    unsigned long long frames;
+    int num_decisions;        /* Tier changes so far */
+    int num_recent;           /* Valid entries in recent, newest first */
+    GovernorDecision recent[GOVERNOR_HISTORY];
+    GovernorTier settings;    /* Settings of the current tier */
+} GovernorStatus;
+
+/* Start governing towards target_ms, never going past max_tier.  The
+ * current simulation settings become tier 0.
+ */
+void governor_init(float target_ms, int max_tier);
+
+/* Record the cost of one frame in seconds; may change the tier */
+void governor_frame(double frame_seconds);
+
+void governor_status(GovernorStatus *status);
+
+#endif /* STORM_GOVERNOR_H */
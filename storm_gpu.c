@@ -0,0 +1,641 @@
+/*
+ * storm_gpu.c
+ *
+ * OpenGL ES 3 / WebGL2 renderer.  See storm_gpu.h.
+ *
+ * The frame is built from four programs:
+ *   glyph      one instanced triangle strip per glyph of glyph_stream; the
+ *              vertex shader interpolates, snaps, scales and rotates the
+ *              quad and looks up the glyph's atlas rectangle, or the
+ *              quarter of it a splash fragment shows
+ *   fill       a full-screen triangle of one color (trail fade, flash)
+ *   present    a full-screen triangle copying the trail canvas
+ *   lightning  the meshes of all live bolts in one draw; the fragment
+ *              shader fades each bolt and turns its glow strip into a soft
+ *              falloff across its width
+ * All positions are in window coordinates, so the canvas can have any
+ * resolution without changing what is drawn into it.
+ */
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL2/SDL.h>
+#include <GLES3/gl3.h>
+
+#include "storm_gpu.h"
+#include "storm_profile.h"
+
+#define GLSL_VERSION "#version 300 es\n"
+
+#define STRINGIFY(x) #x
+#define TO_STRING(x) STRINGIFY(x)
+
+/* Vertex attribute locations of the glyph instances */
+#define ATTR_MOTION 0         /* x, y, mx, my */
+#define ATTR_FRAME 1          /* sine, cosine, scale */
+#define ATTR_COLOR 2
+#define ATTR_GLYPH 3           /* glyph, flags */
+
+static const char *glyph_vs =
+    GLSL_VERSION
+    "layout(location = 0) in vec4 a_motion;\n"
+    "layout(location = 1) in vec3 a_frame;\n"
+    "layout(location = 2) in vec4 a_color;\n"
+    "layout(location = 3) in uvec2 a_glyph;\n"
+    "uniform sampler2D u_glyph_rects;\n"
+    "uniform vec2 u_view;\n"      /* Window size in pixels */
+    "uniform vec2 u_cell;\n"      /* Character cell size in pixels */
+    "uniform float u_rewind;\n"   /* Fraction of the last step to undo */
+    "out vec2 v_uv;\n"
+    "out vec4 v_color;\n"
+    "void main() {\n"
+    "    vec2 pos = a_motion.xy - a_motion.zw * u_rewind;\n"
+    "    vec4 rect = texelFetch(u_glyph_rects, ivec2(int(a_glyph.x), 0), 0);\n"
+    /* Same cull as the SDL path; invalid glyphs have an empty rectangle */
+    "    if (pos.y < -u_cell.y || pos.y > u_view.y || rect.z == 0.0) {\n"
+    "        gl_Position = vec4(0.0, 0.0, 2.0, 1.0);\n"
+    "        return;\n"
+    "    }\n"
+    /* Strip corners (0,0) (1,0) (0,1) (1,1) */
+    "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+    "    vec2 extent, center;\n"
+    "    if ((a_glyph.y & " TO_STRING(GLYPH_FRAGMENT) "u) != 0u) {\n"
+    /* Splash fragment: a quarter of the glyph, scaled both ways about its unsnapped center */
+    "        uint quarter = (a_glyph.y >> " TO_STRING(GLYPH_QUARTER_SHIFT) "u) & 3u;\n"
+    "        rect.zw *= 0.5;\n"
+    "        rect.xy += vec2(float(quarter & 1u), float(quarter >> 1u)) * rect.zw;\n"
+    "        extent = u_cell * (0.25 * a_frame.z);\n"
+    "        center = pos;\n"
+    "    } else {\n"
+    "        float width = trunc(u_cell.x * a_frame.z);\n"
+    "        float offset = trunc((u_cell.x - width) * 0.5);\n"
+    "        extent = vec2(width, u_cell.y) * 0.5;\n"
+    "        center = trunc(pos) + vec2(offset, 0.0) + extent;\n"
+    "    }\n"
+    /* Rotate by -fall_angle about the center */
+    "    vec2 local = (corner * 2.0 - 1.0) * extent;\n"
+    "    vec2 p = center + vec2(local.x * a_frame.y + local.y * a_frame.x,\n"
+    "                           local.y * a_frame.y - local.x * a_frame.x);\n"
+    "    gl_Position = vec4(p.x / u_view.x * 2.0 - 1.0, 1.0 - p.y / u_view.y * 2.0, 0.0, 1.0);\n"
+    "    v_uv = rect.xy + corner * rect.zw;\n"
+    "    v_color = a_color;\n"
+    "}\n";
+
+static const char *glyph_fs =
+    GLSL_VERSION
+    "precision mediump float;\n"
+    "uniform sampler2D u_atlas;\n"
+    "in vec2 v_uv;\n"
+    "in vec4 v_color;\n"
+    "out vec4 frag;\n"
+    "void main() {\n"
+    "    frag = texture(u_atlas, v_uv) * v_color;\n"
+    "}\n";
+
+/* One triangle covering the viewport, with texture coordinates for the canvas */
+static const char *screen_vs =
+    GLSL_VERSION
+    "out vec2 v_uv;\n"
+    "void main() {\n"
+    "    v_uv = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));\n"
+    "    gl_Position = vec4(v_uv * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+static const char *fill_fs =
+    GLSL_VERSION
+    "precision mediump float;\n"
+    "uniform vec4 u_color;\n"
+    "out vec4 frag;\n"
+    "void main() {\n"
+    "    frag = u_color;\n"
+    "}\n";
+
+static const char *present_fs =
+    GLSL_VERSION
+    "precision mediump float;\n"
+    "uniform sampler2D u_canvas;\n"
+    "in vec2 v_uv;\n"
+    "out vec4 frag;\n"
+    "void main() {\n"
+    "    frag = vec4(texture(u_canvas, v_uv).rgb, 1.0);\n"
+    "}\n";
+
+/* The vertex buffer mirrors the pool's vertex arena, so a vertex's slot
+ * follows from its index.  Strips alternate sides vertex by vertex (see
+ * build_lightning_strip), so the parity of the index within the slot tells
+ * which edge a vertex is on. */
+static const char *lightning_vs =
+    GLSL_VERSION
+    "layout(location = 0) in vec2 a_position;\n"
+    "layout(location = 1) in vec4 a_color;\n"
+    "uniform vec2 u_view;\n"
+    "uniform int u_slot_vertices;\n"
+    "uniform int u_glow_vertices[" TO_STRING(LIGHTNING_SLOTS) "];\n"
+    "uniform float u_fade[" TO_STRING(LIGHTNING_SLOTS) "];\n"
+    "out vec3 v_color;\n"
+    "out float v_side;\n"
+    "flat out int v_glow;\n"
+    "flat out float v_fade;\n"
+    "void main() {\n"
+    "    int slot = gl_VertexID / u_slot_vertices;\n"
+    "    int vertex = gl_VertexID - slot * u_slot_vertices;\n"
+    "    v_color = a_color.rgb;\n"
+    "    v_side = (vertex & 1) == 0 ? 1.0 : -1.0;\n"
+    "    v_glow = vertex < u_glow_vertices[slot] ? 1 : 0;\n"
+    "    v_fade = u_fade[slot];\n"
+    "    gl_Position = vec4(a_position.x / u_view.x * 2.0 - 1.0, 1.0 - a_position.y / u_view.y * 2.0, 0.0, 1.0);\n"
+    "}\n";
+
+/* The glow peaks at the core's alpha and falls off linearly to the edges,
+ * the same average as the flat half-alpha glow of the SDL path */
+static const char *lightning_fs =
+    GLSL_VERSION
+    "precision mediump float;\n"
+    "in vec3 v_color;\n"
+    "in float v_side;\n"
+    "flat in int v_glow;\n"
+    "flat in float v_fade;\n"
+    "out vec4 frag;\n"
+    "void main() {\n"
+    "    float a = v_glow == 1 ? v_fade * (1.0 - abs(v_side)) : v_fade;\n"
+    "    frag = vec4(v_color, a);\n"
+    "}\n";
+
+static struct {
+    SDL_Window *window;
+    SDL_GLContext context;
+
+    GLuint glyph_program, fill_program, present_program, lightning_program;
+    GLint glyph_view, glyph_cell, glyph_rewind;
+    GLint fill_color;
+    GLint lightning_view, lightning_slot_vertices, lightning_glow_vertices, lightning_fade;
+
+    GLuint atlas;             /* Glyph atlas, texture unit 0 */
+    GLuint glyph_rects;       /* RGBA32F row of atlas rectangles by glyph, texture unit 1 */
+    GLuint glyph_vao, instance_buffer;
+    size_t instance_capacity; /* Instances the buffer can hold */
+    GLuint screen_vao;        /* No attributes; full-screen passes use gl_VertexID */
+
+    GLuint canvas, canvas_fbo;
+    int canvas_w, canvas_h;
+
+    GLuint lightning_vao, lightning_vbo, lightning_ibo;
+    unsigned lightning_generation;               /* Arena layout the buffers are sized for */
+    unsigned lightning_serials[LIGHTNING_SLOTS];  /* Bolt uploaded to each slot; 0 = none */
+
+    /* Offscreen target replacing the window's framebuffer; 0 = the window */
+    GLuint screen_fbo, screen_rbo;
+    int screen_w, screen_h;
+    GLuint readback[GPU_READBACKS];  /* Pixel pack buffers, used in turn */
+    int readback_next;        /* Buffer the next readback goes to */
+    int readback_pending;     /* Readbacks not yet collected */
+} gpu;
+
+void gpu_set_attributes(void) {
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_ES);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 0);
+}
+
+static GLuint compile_shader(GLenum type, const char *source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, NULL);
+    glCompileShader(shader);
+    GLint ok = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), NULL, log);
+        printf("Shader compile error: %s\n", log);
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+static GLuint link_program(const char *vs_source, const char *fs_source) {
+    GLuint vs = compile_shader(GL_VERTEX_SHADER, vs_source);
+    GLuint fs = compile_shader(GL_FRAGMENT_SHADER, fs_source);
+    GLuint program = 0;
+    if (vs && fs) {
+        program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+        GLint ok = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &ok);
+        if (!ok) {
+            char log[1024];
+            glGetProgramInfoLog(program, sizeof(log), NULL, log);
+            printf("Shader link error: %s\n", log);
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+    if (vs) glDeleteShader(vs);
+    if (fs) glDeleteShader(fs);
+    return program;
+}
+
+bool gpu_init(SDL_Window *window) {
+    gpu.window = window;
+    gpu.context = SDL_GL_CreateContext(window);
+    if (!gpu.context) {
+        printf("SDL_GL_CreateContext Error: %s\n", SDL_GetError());
+        return false;
+    }
+    SDL_GL_SetSwapInterval(1);
+    printf("GPU renderer: %s (%s)\n", (const char *)glGetString(GL_RENDERER),
+           (const char *)glGetString(GL_VERSION));
+
+    gpu.glyph_program = link_program(glyph_vs, glyph_fs);
+    gpu.fill_program = link_program(screen_vs, fill_fs);
+    gpu.present_program = link_program(screen_vs, present_fs);
+    gpu.lightning_program = link_program(lightning_vs, lightning_fs);
+    if (!gpu.glyph_program || !gpu.fill_program || !gpu.present_program || !gpu.lightning_program) {
+        gpu_shutdown();
+        return false;
+    }
+
+    glUseProgram(gpu.glyph_program);
+    glUniform1i(glGetUniformLocation(gpu.glyph_program, "u_atlas"), 0);
+    glUniform1i(glGetUniformLocation(gpu.glyph_program, "u_glyph_rects"), 1);
+    gpu.glyph_view = glGetUniformLocation(gpu.glyph_program, "u_view");
+    gpu.glyph_cell = glGetUniformLocation(gpu.glyph_program, "u_cell");
+    gpu.glyph_rewind = glGetUniformLocation(gpu.glyph_program, "u_rewind");
+    gpu.fill_color = glGetUniformLocation(gpu.fill_program, "u_color");
+    glUseProgram(gpu.present_program);
+    glUniform1i(glGetUniformLocation(gpu.present_program, "u_canvas"), 0);
+    gpu.lightning_view = glGetUniformLocation(gpu.lightning_program, "u_view");
+    gpu.lightning_slot_vertices = glGetUniformLocation(gpu.lightning_program, "u_slot_vertices");
+    gpu.lightning_glow_vertices = glGetUniformLocation(gpu.lightning_program, "u_glow_vertices");
+    gpu.lightning_fade = glGetUniformLocation(gpu.lightning_program, "u_fade");
+
+    /* Glyph instances are GlyphInstance records straight from glyph_stream */
+    glGenVertexArrays(1, &gpu.glyph_vao);
+    glGenBuffers(1, &gpu.instance_buffer);
+    glBindVertexArray(gpu.glyph_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.instance_buffer);
+    GLsizei stride = sizeof(GlyphInstance);
+    glEnableVertexAttribArray(ATTR_MOTION);
+    glVertexAttribPointer(ATTR_MOTION, 4, GL_FLOAT, GL_FALSE, stride, (void *)offsetof(GlyphInstance, x));
+    glEnableVertexAttribArray(ATTR_FRAME);
+    glVertexAttribPointer(ATTR_FRAME, 3, GL_FLOAT, GL_FALSE, stride, (void *)offsetof(GlyphInstance, sine));
+    glEnableVertexAttribArray(ATTR_COLOR);
+    glVertexAttribPointer(ATTR_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void *)offsetof(GlyphInstance, color));
+    glEnableVertexAttribArray(ATTR_GLYPH);
+    glVertexAttribIPointer(ATTR_GLYPH, 2, GL_UNSIGNED_SHORT, stride, (void *)offsetof(GlyphInstance, glyph));
+    glVertexAttribDivisor(ATTR_MOTION, 1);
+    glVertexAttribDivisor(ATTR_FRAME, 1);
+    glVertexAttribDivisor(ATTR_COLOR, 1);
+    glVertexAttribDivisor(ATTR_GLYPH, 1);
+
+    glGenVertexArrays(1, &gpu.lightning_vao);
+    glGenBuffers(1, &gpu.lightning_vbo);
+    glGenBuffers(1, &gpu.lightning_ibo);
+    glBindVertexArray(gpu.lightning_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.lightning_vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gpu.lightning_ibo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(SDL_Vertex), (void *)offsetof(SDL_Vertex, position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SDL_Vertex), (void *)offsetof(SDL_Vertex, color));
+
+    glGenVertexArrays(1, &gpu.screen_vao);
+    glBindVertexArray(0);
+
+    /* SDL_BLENDMODE_BLEND */
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    return true;
+}
+
+bool gpu_load_atlas(SDL_Surface *atlas, const SDL_FRect *uv, const bool *valid, int count) {
+    /* GL_RGBA with GL_UNSIGNED_BYTE is R, G, B, A in memory */
+    SDL_Surface *rgba = SDL_ConvertSurfaceFormat(atlas, SDL_PIXELFORMAT_ABGR8888, 0);
+    if (!rgba) {
+        printf("SDL_ConvertSurfaceFormat Error: %s\n", SDL_GetError());
+        return false;
+    }
+    /* Both textures are replaced, or neither */
+    float *rects = calloc((size_t)count * 4, sizeof(float));
+    if (!rects) {
+        SDL_FreeSurface(rgba);
+        return false;
+    }
+    if (!gpu.atlas) glGenTextures(1, &gpu.atlas);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, gpu.atlas);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, rgba->pitch / 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, rgba->w, rgba->h, 0, GL_RGBA, GL_UNSIGNED_BYTE, rgba->pixels);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    SDL_FreeSurface(rgba);
+
+    for (int i = 0; i < count; i++) {
+        if (!valid[i]) continue;
+        rects[i * 4 + 0] = uv[i].x;
+        rects[i * 4 + 1] = uv[i].y;
+        rects[i * 4 + 2] = uv[i].w;
+        rects[i * 4 + 3] = uv[i].h;
+    }
+    if (!gpu.glyph_rects) glGenTextures(1, &gpu.glyph_rects);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, gpu.glyph_rects);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, count, 1, 0, GL_RGBA, GL_FLOAT, rects);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glActiveTexture(GL_TEXTURE0);
+    free(rects);
+    return true;
+}
+
+/* Make the trail canvas w x h, resampling the trails drawn so far */
+static bool resize_canvas(int w, int h) {
+    GLuint old = gpu.canvas, old_fbo = gpu.canvas_fbo;
+    int old_w = gpu.canvas_w, old_h = gpu.canvas_h;
+
+    glGenTextures(1, &gpu.canvas);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, gpu.canvas);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glGenFramebuffers(1, &gpu.canvas_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, gpu.canvas_fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gpu.canvas, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        printf("Trail canvas framebuffer is incomplete\n");
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &gpu.canvas_fbo);
+        glDeleteTextures(1, &gpu.canvas);
+        gpu.canvas = old;
+        gpu.canvas_fbo = old_fbo;
+        return false;
+    }
+    gpu.canvas_w = w;
+    gpu.canvas_h = h;
+
+    glViewport(0, 0, w, h);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    if (old_fbo) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, old_fbo);
+        glBlitFramebuffer(0, 0, old_w, old_h, 0, 0, w, h, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &old_fbo);
+        glDeleteTextures(1, &old);
+    }
+    return true;
+}
+
+/* Upload the glyph instances and the splash fragments after them and draw
+ * them all in one instanced call */
+static void draw_glyphs(float alpha) {
+    size_t total = glyph_stream.count + glyph_stream.fragments;
+    if (!gpu.atlas || total == 0) return;
+    size_t bytes = glyph_stream.count * sizeof(GlyphInstance);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.instance_buffer);
+    if (total > gpu.instance_capacity) {
+        size_t capacity = gpu.instance_capacity ? gpu.instance_capacity : 1024;
+        while (capacity < total) capacity *= 2;
+        glBufferData(GL_ARRAY_BUFFER, capacity * sizeof(GlyphInstance), NULL, GL_STREAM_DRAW);
+        gpu.instance_capacity = capacity;
+    } else {
+        /* Orphan last frame's instances instead of waiting for the GPU to finish with them */
+        glBufferData(GL_ARRAY_BUFFER, gpu.instance_capacity * sizeof(GlyphInstance), NULL, GL_STREAM_DRAW);
+    }
+    if (bytes > 0) glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, glyph_stream.instances);
+    if (glyph_stream.fragments > 0) {
+        glBufferSubData(GL_ARRAY_BUFFER, bytes, glyph_stream.fragments * sizeof(GlyphInstance),
+                        glyph_stream.fragment_instances);
+    }
+
+    glUseProgram(gpu.glyph_program);
+    glUniform2f(gpu.glyph_view, (float)g_screen_width, (float)g_screen_height);
+    glUniform2f(gpu.glyph_cell, (float)char_width, (float)char_height);
+    glUniform1f(gpu.glyph_rewind, 1.0f - alpha);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, gpu.glyph_rects);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, gpu.atlas);
+    glBindVertexArray(gpu.glyph_vao);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)total);
+    profile_count(PROFILE_DRAW_CALLS, 1);
+}
+
+static void fill_screen(float r, float g, float b, float a) {
+    glUseProgram(gpu.fill_program);
+    glUniform4f(gpu.fill_color, r, g, b, a);
+    glBindVertexArray(gpu.screen_vao);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    profile_count(PROFILE_DRAW_CALLS, 1);
+}
+
+/*
+ * Draw all live bolts with one call.  The buffers mirror the pool's arenas:
+ * a slot is uploaded once when a new bolt first shows and again when it
+ * expires, leaving degenerate indices.  The draw covers the slots up to the
+ * last live bolt, with each bolt's fade and glow passed per slot.
+ */
+static void draw_lightning(void) {
+    glBindVertexArray(gpu.lightning_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, gpu.lightning_vbo);
+    size_t slot_vertices_size = lightning.slot_vertices * sizeof(SDL_Vertex);
+    size_t slot_indices_size = lightning.slot_indices * sizeof(int);
+    if (gpu.lightning_generation != lightning.generation) {
+        glBufferData(GL_ARRAY_BUFFER, LIGHTNING_SLOTS * slot_vertices_size, NULL, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, LIGHTNING_SLOTS * slot_indices_size, lightning.indices,
+                     GL_DYNAMIC_DRAW);
+        memset(gpu.lightning_serials, 0, sizeof(gpu.lightning_serials));
+        gpu.lightning_generation = lightning.generation;
+    }
+
+    int glow_vertices[LIGHTNING_SLOTS];
+    float fade[LIGHTNING_SLOTS];
+    int draw_slots = 0;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        unsigned serial = l->active && l->num_indices > 0 ? l->serial : 0;
+        if (serial != gpu.lightning_serials[i]) {
+            if (serial)
+                glBufferSubData(GL_ARRAY_BUFFER, i * slot_vertices_size, l->num_vertices * sizeof(SDL_Vertex),
+                                l->vertices);
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, i * slot_indices_size, slot_indices_size, l->indices);
+            gpu.lightning_serials[i] = serial;
+        }
+        glow_vertices[i] = 0;
+        fade[i] = 0.0f;
+        if (serial) {
+            glow_vertices[i] = l->num_glow_vertices;
+            fade[i] = l->initial_timer > 0.0f ? l->timer / l->initial_timer : 0.0f;
+            if (fade[i] < 0.0f) fade[i] = 0.0f;
+            if (fade[i] > 1.0f) fade[i] = 1.0f;
+            draw_slots = i + 1;
+        }
+    }
+    if (draw_slots == 0) return;
+
+    glUseProgram(gpu.lightning_program);
+    glUniform2f(gpu.lightning_view, (float)g_screen_width, (float)g_screen_height);
+    glUniform1i(gpu.lightning_slot_vertices, lightning.slot_vertices);
+    glUniform1iv(gpu.lightning_glow_vertices, LIGHTNING_SLOTS, glow_vertices);
+    glUniform1fv(gpu.lightning_fade, LIGHTNING_SLOTS, fade);
+    glDrawElements(GL_TRIANGLES, draw_slots * lightning.slot_indices, GL_UNSIGNED_INT, NULL);
+    profile_count(PROFILE_DRAW_CALLS, 1);
+}
+
+void gpu_render_frame(const GpuFrame *frame) {
+    int drawable_w = gpu.screen_w, drawable_h = gpu.screen_h;
+    if (!gpu.screen_fbo)
+        SDL_GL_GetDrawableSize(gpu.window, &drawable_w, &drawable_h);
+    glEnable(GL_BLEND);
+
+    if (frame->canvas_trails) {
+        int w = (int)(drawable_w * frame->canvas_scale + 0.5f);
+        int h = (int)(drawable_h * frame->canvas_scale + 0.5f);
+        if (w < 1) w = 1;
+        if (h < 1) h = 1;
+        if ((w != gpu.canvas_w || h != gpu.canvas_h) && !resize_canvas(w, h))
+            return;
+        Uint64 t = profile_begin();
+        glBindFramebuffer(GL_FRAMEBUFFER, gpu.canvas_fbo);
+        glViewport(0, 0, gpu.canvas_w, gpu.canvas_h);
+        fill_screen(0.0f, 0.0f, 0.0f, 200.0f / 255.0f);  /* Trail fade */
+        t = profile_end(PROFILE_FADE, t);
+        draw_glyphs(frame->alpha);
+        t = profile_end(PROFILE_GLYPHS, t);
+
+        glBindFramebuffer(GL_FRAMEBUFFER, gpu.screen_fbo);
+        glViewport(0, 0, drawable_w, drawable_h);
+        glDisable(GL_BLEND);
+        glUseProgram(gpu.present_program);
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, gpu.canvas);
+        glBindVertexArray(gpu.screen_vao);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        profile_count(PROFILE_DRAW_CALLS, 1);
+        glEnable(GL_BLEND);
+        profile_end(PROFILE_CANVAS_COPY, t);
+    } else {
+        if (gpu.canvas) {
+            /* Trails are part of the glyph alpha; the canvas is not needed */
+            glDeleteFramebuffers(1, &gpu.canvas_fbo);
+            glDeleteTextures(1, &gpu.canvas);
+            gpu.canvas = gpu.canvas_fbo = 0;
+            gpu.canvas_w = gpu.canvas_h = 0;
+        }
+        Uint64 t = profile_begin();
+        glBindFramebuffer(GL_FRAMEBUFFER, gpu.screen_fbo);
+        glViewport(0, 0, drawable_w, drawable_h);
+        glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        t = profile_end(PROFILE_FADE, t);
+        draw_glyphs(frame->alpha);
+        profile_end(PROFILE_GLYPHS, t);
+    }
+
+    if (lightning.count > 0) {
+        Uint64 t = profile_begin();
+        draw_lightning();
+        float flash = lightning_flash_alpha();
+        if (flash > 0.0f)
+            fill_screen(1.0f, 1.0f, 1.0f, flash);
+        profile_end(PROFILE_DRAW_LIGHTNING, t);
+    }
+    glBindVertexArray(0);
+}
+
+void gpu_present(void) {
+    SDL_GL_SwapWindow(gpu.window);
+}
+
+bool gpu_set_offscreen(int width, int height) {
+    glGenRenderbuffers(1, &gpu.screen_rbo);
+    glBindRenderbuffer(GL_RENDERBUFFER, gpu.screen_rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glGenFramebuffers(1, &gpu.screen_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, gpu.screen_fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, gpu.screen_rbo);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    if (!complete) {
+        printf("Offscreen framebuffer is incomplete\n");
+        glDeleteFramebuffers(1, &gpu.screen_fbo);
+        glDeleteRenderbuffers(1, &gpu.screen_rbo);
+        gpu.screen_fbo = gpu.screen_rbo = 0;
+        return false;
+    }
+    gpu.screen_w = width;
+    gpu.screen_h = height;
+    return true;
+}
+
+#ifndef __EMSCRIPTEN__
+void gpu_begin_readback(void) {
+    size_t size = (size_t)gpu.screen_w * gpu.screen_h * 4;
+    if (!gpu.readback[0]) {
+        glGenBuffers(GPU_READBACKS, gpu.readback);
+        for (int i = 0; i < GPU_READBACKS; i++) {
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, gpu.readback[i]);
+            glBufferData(GL_PIXEL_PACK_BUFFER, size, NULL, GL_STREAM_READ);
+        }
+    }
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, gpu.screen_fbo);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, gpu.readback[gpu.readback_next]);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    /* With a pack buffer bound this only queues the copy */
+    glReadPixels(0, 0, gpu.screen_w, gpu.screen_h, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    gpu.readback_next = (gpu.readback_next + 1) % GPU_READBACKS;
+    gpu.readback_pending++;
+}
+
+bool gpu_end_readback(unsigned char *pixels) {
+    if (gpu.readback_pending == 0) return false;
+    int index = (gpu.readback_next - gpu.readback_pending + GPU_READBACKS) % GPU_READBACKS;
+    size_t size = (size_t)gpu.screen_w * gpu.screen_h * 4;
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, gpu.readback[index]);
+    void *mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT);
+    if (mapped) {
+        memcpy(pixels, mapped, size);
+        glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    gpu.readback_pending--;
+    return mapped != NULL;
+}
+#endif
+
+void gpu_shutdown(void) {
+    if (!gpu.context) return;
+    glDeleteProgram(gpu.glyph_program);
+    glDeleteProgram(gpu.fill_program);
+    glDeleteProgram(gpu.present_program);
+    glDeleteProgram(gpu.lightning_program);
+    glDeleteTextures(1, &gpu.atlas);
+    glDeleteTextures(1, &gpu.glyph_rects);
+    glDeleteTextures(1, &gpu.canvas);
+    glDeleteFramebuffers(1, &gpu.canvas_fbo);
+    glDeleteBuffers(1, &gpu.instance_buffer);
+    glDeleteBuffers(1, &gpu.lightning_vbo);
+    glDeleteBuffers(1, &gpu.lightning_ibo);
+    glDeleteVertexArrays(1, &gpu.glyph_vao);
+    glDeleteVertexArrays(1, &gpu.lightning_vao);
+    glDeleteVertexArrays(1, &gpu.screen_vao);
+    glDeleteFramebuffers(1, &gpu.screen_fbo);
+    glDeleteRenderbuffers(1, &gpu.screen_rbo);
+    if (gpu.readback[0]) glDeleteBuffers(GPU_READBACKS, gpu.readback);
+    SDL_GL_DeleteContext(gpu.context);
+    memset(&gpu, 0, sizeof(gpu));
+}
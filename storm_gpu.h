@@ -0,0 +1,65 @@
+/*
+ * storm_gpu.h
+ *
+ * OpenGL ES 3 / WebGL2 renderer, an alternative to the SDL_Renderer path.
+ * The glyph stream is uploaded as an instance buffer and expanded into
+ * rotated, depth-scaled quads by a vertex shader; the trail fade, canvas
+ * upscale and lightning glow are fragment shaders.  A frame is at most five
+ * draw calls whatever the number of glyphs and concurrent bolts.
+ *
+ * All functions must be called from the thread that owns the window.
+ */
+
+#ifndef STORM_GPU_H
+#define STORM_GPU_H
+
+#include <stdbool.h>
+#include <SDL2/SDL.h>
+
+#include "storm_sim.h"
+
+/* What one frame draws */
+typedef struct {
+    float alpha;              /* Interpolation between the last two steps (0 = previous, 1 = latest) */
+    bool canvas_trails;       /* Fade an offscreen canvas (true) or draw straight to the screen */
+    float canvas_scale;       /* Canvas resolution relative to the window */
+} GpuFrame;
+
+/* Set the context attributes the backend needs; call before the window is
+ * created with SDL_WINDOW_OPENGL */
+void gpu_set_attributes(void);
+
+/* Create the context on window and compile the shaders */
+bool gpu_init(SDL_Window *window);
+
+/* Upload the glyph atlas and the texture rectangle of each glyph; glyphs
+ * that are not valid are never drawn */
+bool gpu_load_atlas(SDL_Surface *atlas, const SDL_FRect *uv, const bool *valid, int count);
+
+/* Draw glyph_stream and the live lightning */
+void gpu_render_frame(const GpuFrame *frame);
+
+/* Show the frame; waits for vsync */
+void gpu_present(void);
+
+/* Pixel pack buffers for gpu_begin_readback() */
+#define GPU_READBACKS 2
+
+/* Draw into an offscreen width x height target instead of the window, for
+ * frame export; the window can then stay hidden */
+bool gpu_set_offscreen(int width, int height);
+
+#ifndef __EMSCRIPTEN__
+/* Start copying the offscreen target into the next pixel pack buffer.  The
+ * copy runs while the next frame is drawn; at most GPU_READBACKS may be
+ * pending. */
+void gpu_begin_readback(void);
+
+/* Collect the oldest pending readback into pixels: width * height RGBA,
+ * bottom row first.  False if none was pending or mapping failed. */
+bool gpu_end_readback(unsigned char *pixels);
+#endif
+
+void gpu_shutdown(void);
+
+#endif /* STORM_GPU_H */
@@ -0,0 +1,160 @@
+/*
+ * storm_pool.c
+ *
+ * Persistent worker pool with work stealing.  See storm_pool.h.
+ */
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <SDL2/SDL.h>
+
+#include "storm_pool.h"
+
+/* Threads are unavailable in Emscripten builds without -pthread */
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+#define POOL_NO_THREADS
+#endif
+
+/* Chunks still owned by one worker, padded to its own cache line */
+typedef struct {
+    SDL_atomic_t next;        /* Next unclaimed chunk */
+    int end;                  /* One past the last chunk of the range */
+    char padding[64 - sizeof(SDL_atomic_t) - sizeof(int)];
+} WorkerRange;
+
+static struct {
+    SDL_Thread *threads[POOL_MAX_WORKERS];
+    int num_workers;          /* Including the calling thread */
+    SDL_mutex *lock;
+    SDL_cond *wake;           /* Signaled when a job is posted or on shutdown */
+    SDL_cond *idle;           /* Signaled when the last worker leaves a job */
+    unsigned generation;      /* Incremented for every posted job */
+    int busy;                 /* Worker threads still inside the current job */
+    bool quit;
+
+    PoolTask task;
+    void *ctx;
+    WorkerRange ranges[POOL_MAX_WORKERS];
+} pool = { .num_workers = 1 };
+
+/* Claim and run chunks, first from the worker's own range, then stolen */
+static void run_chunks(int worker) {
+    for (int k = 0; k < pool.num_workers; k++) {
+        WorkerRange *range = &pool.ranges[(worker + k) % pool.num_workers];
+        for (;;) {
+            int chunk = SDL_AtomicAdd(&range->next, 1);
+            if (chunk >= range->end)
+                break;
+            pool.task(pool.ctx, chunk, worker);
+        }
+    }
+}
+
+static int worker_main(void *arg) {
+    int worker = (int)(intptr_t)arg;
+    unsigned seen = 0;
+
+    SDL_LockMutex(pool.lock);
+    for (;;) {
+        while (!pool.quit && pool.generation == seen)
+            SDL_CondWait(pool.wake, pool.lock);
+        if (pool.quit)
+            break;
+        seen = pool.generation;
+        SDL_UnlockMutex(pool.lock);
+
+        run_chunks(worker);
+
+        SDL_LockMutex(pool.lock);
+        if (--pool.busy == 0)
+            SDL_CondSignal(pool.idle);
+    }
+    SDL_UnlockMutex(pool.lock);
+    return 0;
+}
+
+void pool_init(int num_workers) {
+    if (num_workers <= 0)
+        num_workers = SDL_GetCPUCount();
+    if (num_workers > POOL_MAX_WORKERS)
+        num_workers = POOL_MAX_WORKERS;
+#ifdef POOL_NO_THREADS
+    num_workers = 1;
+#endif
+    pool.num_workers = 1;
+    if (num_workers <= 1)
+        return;
+
+    pool.lock = SDL_CreateMutex();
+    pool.wake = SDL_CreateCond();
+    pool.idle = SDL_CreateCond();
+    if (!pool.lock || !pool.wake || !pool.idle) {
+        printf("Worker pool unavailable: %s\n", SDL_GetError());
+        pool_shutdown();
+        return;
+    }
+    pool.quit = false;
+    for (int w = 1; w < num_workers; w++) {
+        pool.threads[w] = SDL_CreateThread(worker_main, "storm worker", (void *)(intptr_t)w);
+        if (!pool.threads[w]) {
+            printf("Failed to start worker %d: %s\n", w, SDL_GetError());
+            break;
+        }
+        pool.num_workers++;
+    }
+}
+
+void pool_shutdown(void) {
+    if (pool.lock) {
+        SDL_LockMutex(pool.lock);
+        pool.quit = true;
+        SDL_CondBroadcast(pool.wake);
+        SDL_UnlockMutex(pool.lock);
+    }
+    for (int w = 1; w < pool.num_workers; w++) {
+        SDL_WaitThread(pool.threads[w], NULL);
+        pool.threads[w] = NULL;
+    }
+    if (pool.idle) SDL_DestroyCond(pool.idle);
+    if (pool.wake) SDL_DestroyCond(pool.wake);
+    if (pool.lock) SDL_DestroyMutex(pool.lock);
+    pool.idle = pool.wake = NULL;
+    pool.lock = NULL;
+    pool.num_workers = 1;
+}
+
+int pool_worker_count(void) {
+    return pool.num_workers;
+}
+
+void pool_run(PoolTask task, void *ctx, int num_chunks) {
+    if (pool.num_workers == 1 || num_chunks < 2) {
+        for (int chunk = 0; chunk < num_chunks; chunk++)
+            task(ctx, chunk, 0);
+        return;
+    }
+
+    /* Give every worker an equal contiguous share to start with */
+    pool.task = task;
+    pool.ctx = ctx;
+    for (int w = 0; w < pool.num_workers; w++) {
+        SDL_AtomicSet(&pool.ranges[w].next, num_chunks * w / pool.num_workers);
+        pool.ranges[w].end = num_chunks * (w + 1) / pool.num_workers;
+    }
+
+    SDL_LockMutex(pool.lock);
+    pool.busy = pool.num_workers - 1;
+    pool.generation++;
+    SDL_CondBroadcast(pool.wake);
+    SDL_UnlockMutex(pool.lock);
+
+    run_chunks(0);
+
+    /* Wait until every worker has left the job before it goes out of scope */
+    SDL_LockMutex(pool.lock);
+    while (pool.busy > 0)
+        SDL_CondWait(pool.idle, pool.lock);
+    SDL_UnlockMutex(pool.lock);
+}
@@ -0,0 +1,31 @@
+/*
+ * storm_pool.h
+ *
+ * Persistent worker pool for splitting simulation work into chunks.
+ *
+ * The calling thread always takes part as worker 0, so a pool with a single
+ * worker simply runs every chunk inline.  Each worker starts on its own
+ * contiguous range of chunks and steals from the others once that range is
+ * exhausted.  Threads come from SDL (pthreads natively, Web Workers under
+ * Emscripten with -pthread); without thread support the pool falls back to
+ * running single-threaded.
+ */
+
+#ifndef STORM_POOL_H
+#define STORM_POOL_H
+
+/* Upper bound on worker threads, including the calling thread */
+#define POOL_MAX_WORKERS 32
+
+/* Process one chunk; `worker` is in [0, pool_worker_count()) */
+typedef void (*PoolTask)(void *ctx, int chunk, int worker);
+
+/* Start the pool with `num_workers` workers in total, or one per CPU if 0 */
+void pool_init(int num_workers);
+void pool_shutdown(void);
+int pool_worker_count(void);
+
+/* Run task for every chunk in [0, num_chunks) and wait for completion */
+void pool_run(PoolTask task, void *ctx, int num_chunks);
+
+#endif /* STORM_POOL_H */
@@ -0,0 +1,148 @@
+/*
+ * storm_power.c
+ *
+ * Frame pacing and power accounting.  See storm_power.h.
+ */
+
+#include <string.h>
+#include <time.h>
+
+#if !defined(__EMSCRIPTEN__) && (defined(__unix__) || defined(__APPLE__))
+/* clock() is process CPU time and nanosleep() exists; elsewhere clock()
+ * may be wall time */
+#define POWER_POSIX
+#include <errno.h>
+#endif
+
+#include <SDL2/SDL.h>
+
+#include "storm_power.h"
+
+static struct {
+    double frame_period;
+    Uint64 period_ticks;      /* frame_period in performance counter ticks */
+    Uint64 deadline;          /* When the last paced frame was due; 0 = not yet scheduled */
+
+    Uint64 start;
+    bool paused;
+    Uint64 paused_at;
+    double paused_seconds;
+    unsigned long long frames;
+    double busy_seconds;
+
+    /* Current one-second window */
+    Uint64 window_start;
+    unsigned long long window_frames;
+    double window_busy;
+    double window_cpu;        /* process_cpu_seconds() at window_start */
+
+    double sample_fps, sample_busy_ms, sample_cpu_ms;
+} pw;
+
+static double process_cpu_seconds(void) {
+#ifdef POWER_POSIX
+    return (double)clock() / CLOCKS_PER_SEC;
+#else
+    return -1.0;
+#endif
+}
+
+static double seconds_between(Uint64 from, Uint64 to) {
+    return (double)(to - from) / SDL_GetPerformanceFrequency();
+}
+
+static void start_window(Uint64 now) {
+    pw.window_start = now;
+    pw.window_frames = 0;
+    pw.window_busy = 0.0;
+    pw.window_cpu = process_cpu_seconds();
+}
+
+void power_init(double frame_period) {
+    memset(&pw, 0, sizeof(pw));
+    pw.frame_period = frame_period > 0.0 ? frame_period : 0.0;
+    pw.period_ticks = (Uint64)(pw.frame_period * SDL_GetPerformanceFrequency());
+    pw.start = SDL_GetPerformanceCounter();
+    pw.sample_cpu_ms = -1.0;
+    start_window(pw.start);
+}
+
+double power_frame_period(void) {
+    return pw.frame_period;
+}
+
+#ifndef __EMSCRIPTEN__
+/* Sleep without rounding to whole milliseconds where the platform allows */
+static void sleep_seconds(double seconds) {
+#ifdef POWER_POSIX
+    struct timespec ts;
+    ts.tv_sec = (time_t)seconds;
+    ts.tv_nsec = (long)((seconds - (double)ts.tv_sec) * 1e9);
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {}
+#else
+    SDL_Delay((Uint32)(seconds * 1000.0 + 0.5));
+#endif
+}
+
+double power_wait_next_frame(void) {
+    if (pw.period_ticks == 0) return 0.0;
+    Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 due = pw.deadline + pw.period_ticks;
+    if (pw.deadline == 0 || now >= due + pw.period_ticks) {
+        pw.deadline = now;  /* First frame, or too far behind to catch up */
+        return 0.0;
+    }
+    pw.deadline = due;
+    if (now >= due) return 0.0;
+    sleep_seconds(seconds_between(now, due));
+    return seconds_between(now, SDL_GetPerformanceCounter());
+}
+#endif
+
+bool power_frame(double work_seconds) {
+    pw.frames++;
+    pw.busy_seconds += work_seconds;
+    pw.window_frames++;
+    pw.window_busy += work_seconds;
+
+    Uint64 now = SDL_GetPerformanceCounter();
+    double window = seconds_between(pw.window_start, now);
+    if (window < 1.0) return false;
+    pw.sample_fps = pw.window_frames / window;
+    pw.sample_busy_ms = pw.window_busy * 1000.0 / window;
+    double cpu = process_cpu_seconds();
+    pw.sample_cpu_ms = cpu >= 0.0 ? (cpu - pw.window_cpu) * 1000.0 / window : -1.0;
+    start_window(now);
+    return true;
+}
+
+double power_set_paused(bool paused) {
+    if (paused == pw.paused) return 0.0;
+    pw.paused = paused;
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (paused) {
+        pw.paused_at = now;
+        return 0.0;
+    }
+    double seconds = seconds_between(pw.paused_at, now);
+    pw.paused_seconds += seconds;
+    pw.deadline = 0;
+    start_window(now);  /* A window spanning the pause would average over it */
+    return seconds;
+}
+
+bool power_paused(void) {
+    return pw.paused;
+}
+
+void power_status(PowerStatus *status) {
+    Uint64 now = SDL_GetPerformanceCounter();
+    status->frames = pw.frames;
+    status->seconds = seconds_between(pw.start, now);
+    status->paused_seconds = pw.paused_seconds + (pw.paused ? seconds_between(pw.paused_at, now) : 0.0);
+    status->busy_seconds = pw.busy_seconds;
+    status->cpu_seconds = process_cpu_seconds();
+    status->sample_fps = pw.sample_fps;
+    status->sample_busy_ms = pw.sample_busy_ms;
+    status->sample_cpu_ms = pw.sample_cpu_ms;
+}
@@ -0,0 +1,61 @@
+/*
+ * storm_power.h
+ *
+ * Frame pacing and power accounting.  Native builds pace frames against
+ * deadlines spaced one frame period apart and sleep until the next one,
+ * so a frame cap below the display rate costs no extra latency or busy
+ * waiting, and no sleep stacks on top of vsync when there is no cap.  Time
+ * spent paused (window hidden or minimized) is accounted separately, and
+ * the frames rendered, main-thread work and process CPU time are reported
+ * per second of wall time.
+ */
+
+#ifndef STORM_POWER_H
+#define STORM_POWER_H
+
+#include <stdbool.h>
+
+/* Frame cap of the low-power mode */
+#define POWER_LOW_FPS 30
+
+/* Snapshot of the power accounting */
+typedef struct {
+    unsigned long long frames;  /* Frames rendered */
+    double seconds;           /* Wall time since power_init(), pauses included */
+    double paused_seconds;    /* Time spent paused */
+    double busy_seconds;      /* Main-thread frame work, without sleeps or vsync waits */
+    double cpu_seconds;       /* Process CPU time of all threads; < 0 where unavailable */
+
+    /* Last complete one-second window, pauses excluded */
+    double sample_fps;
+    double sample_busy_ms;    /* Main-thread work per second */
+    double sample_cpu_ms;     /* Process CPU time per second; < 0 where unavailable */
+} PowerStatus;
+
+/* Start accounting; frames are paced frame_period seconds apart, or not at
+ * all with 0 */
+void power_init(double frame_period);
+
+/* Seconds between paced frames; 0 if unpaced */
+double power_frame_period(void);
+
+#ifndef __EMSCRIPTEN__
+/* Sleep until the next frame is due and return the seconds slept.  After
+ * falling more than a period behind, the schedule restarts from now rather
+ * than rushing frames out to catch up. */
+double power_wait_next_frame(void);
+#endif
+
+/* Record a rendered frame and the seconds of work it took.  Returns true
+ * when a new one-second sample is available from power_status(). */
+bool power_frame(double work_seconds);
+
+/* Enter or leave the paused state.  Returns the length in seconds of the
+ * pause that just ended, 0 otherwise. */
+double power_set_paused(bool paused);
+
+bool power_paused(void);
+
+void power_status(PowerStatus *status);
+
+#endif /* STORM_POWER_H */
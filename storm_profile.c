@@ -0,0 +1,167 @@
+/*
+ * storm_profile.c
+ *
+ * Frame profiler.  See storm_profile.h.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "storm_profile.h"
+
+const char *const profile_phase_names[PROFILE_NUM_PHASES] = {
+    "frame", "events", "wind", "columns", "lightning", "particles", "fade",
+    "glyphs", "canvas copy", "draw lightning", "hud", "present",
+};
+
+const char *const profile_counter_names[PROFILE_NUM_COUNTERS] = {
+    "live columns", "live particles", "glyphs drawn", "draw calls", "sim allocations",
+};
+
+typedef struct {
+    Uint64 start, end;
+    int phase;
+} ProfileEvent;
+
+typedef struct {
+    Uint64 end;
+    long long counters[PROFILE_NUM_COUNTERS];
+} ProfileFrame;
+
+static ProfileEvent ring[PROFILE_RING];
+static SDL_atomic_t ring_head;    /* Events ever recorded; wraps with the ring */
+
+static struct {
+    Uint64 origin;            /* Trace time zero */
+    Uint64 phase_ticks[PROFILE_NUM_PHASES];        /* Totals of the current frame */
+    long long counters[PROFILE_NUM_COUNTERS];      /* Of the current frame */
+
+    float history[PROFILE_HISTORY][PROFILE_NUM_PHASES];  /* ms per frame, ring */
+    int history_count;
+    int history_next;
+
+    ProfileFrame frames[PROFILE_FRAME_RING];
+    unsigned long long num_frames;
+
+    char json[2048];
+} prof;
+
+void profile_init(void) {
+    memset(&prof, 0, sizeof(prof));
+    SDL_AtomicSet(&ring_head, 0);
+    prof.origin = SDL_GetPerformanceCounter();
+}
+
+Uint64 profile_end(ProfilePhase phase, Uint64 start) {
+    Uint64 end = SDL_GetPerformanceCounter();
+    prof.phase_ticks[phase] += end - start;
+    unsigned head = (unsigned)SDL_AtomicGet(&ring_head);
+    ProfileEvent *e = &ring[head & (PROFILE_RING - 1)];
+    e->start = start;
+    e->end = end;
+    e->phase = phase;
+    SDL_AtomicSet(&ring_head, (int)(head + 1));  /* Full barrier: the event is visible first */
+    return end;
+}
+
+void profile_count(ProfileCounter counter, long long amount) {
+    prof.counters[counter] += amount;
+}
+
+void profile_frame_end(void) {
+    double ms_per_tick = 1000.0 / SDL_GetPerformanceFrequency();
+    float *h = prof.history[prof.history_next];
+    for (int p = 0; p < PROFILE_NUM_PHASES; p++) {
+        h[p] = (float)(prof.phase_ticks[p] * ms_per_tick);
+        prof.phase_ticks[p] = 0;
+    }
+    prof.history_next = (prof.history_next + 1) % PROFILE_HISTORY;
+    if (prof.history_count < PROFILE_HISTORY) prof.history_count++;
+
+    ProfileFrame *f = &prof.frames[prof.num_frames % PROFILE_FRAME_RING];
+    f->end = SDL_GetPerformanceCounter();
+    memcpy(f->counters, prof.counters, sizeof(f->counters));
+    memset(prof.counters, 0, sizeof(prof.counters));
+    prof.num_frames++;
+}
+
+static int compare_floats(const void *a, const void *b) {
+    float x = *(const float *)a, y = *(const float *)b;
+    return (x > y) - (x < y);
+}
+
+void profile_stats(ProfileStats *stats) {
+    memset(stats, 0, sizeof(*stats));
+    int n = prof.history_count;
+    stats->frames = n;
+    if (prof.num_frames > 0) {
+        const ProfileFrame *last = &prof.frames[(prof.num_frames - 1) % PROFILE_FRAME_RING];
+        memcpy(stats->counters, last->counters, sizeof(stats->counters));
+    }
+    if (n == 0) return;
+
+    float sorted[PROFILE_HISTORY];
+    for (int p = 0; p < PROFILE_NUM_PHASES; p++) {
+        for (int i = 0; i < n; i++)
+            sorted[i] = prof.history[i][p];
+        qsort(sorted, (size_t)n, sizeof(float), compare_floats);
+        stats->p50_ms[p] = sorted[(n - 1) / 2];
+        stats->p99_ms[p] = sorted[(n * 99 + 99) / 100 - 1];
+    }
+}
+
+const char *profile_stats_json(void) {
+    ProfileStats stats;
+    profile_stats(&stats);
+    char *out = prof.json;
+    size_t left = sizeof(prof.json);
+    int n = snprintf(out, left, "{\"frames\":%d,\"phases\":{", stats.frames);
+    for (int p = 0; p < PROFILE_NUM_PHASES && n > 0 && (size_t)n < left; p++) {
+        out += n;
+        left -= (size_t)n;
+        n = snprintf(out, left, "%s\"%s\":{\"p50_ms\":%.4f,\"p99_ms\":%.4f}", p ? "," : "",
+                     profile_phase_names[p], stats.p50_ms[p], stats.p99_ms[p]);
+    }
+    for (int c = 0; c < PROFILE_NUM_COUNTERS && n > 0 && (size_t)n < left; c++) {
+        out += n;
+        left -= (size_t)n;
+        n = snprintf(out, left, "%s\"%s\":%lld", c ? "," : "},\"counters\":{",
+                     profile_counter_names[c], stats.counters[c]);
+    }
+    if (n > 0 && (size_t)n < left)
+        snprintf(out + n, left - (size_t)n, "}}");
+    return prof.json;
+}
+
+bool profile_write_trace(FILE *out) {
+    double us_per_tick = 1e6 / SDL_GetPerformanceFrequency();
+    unsigned head = (unsigned)SDL_AtomicGet(&ring_head);
+    unsigned count = head < PROFILE_RING ? head : PROFILE_RING;
+
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    fprintf(out, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"matrix storm\"}},\n");
+    fprintf(out, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}");
+    Uint64 first = 0;
+    for (unsigned i = head - count; i != head; i++) {
+        const ProfileEvent *e = &ring[i & (PROFILE_RING - 1)];
+        if (i == head - count) first = e->start;
+        const char *cat = e->phase == PROFILE_FRAME ? "frame" :
+                          (e->phase >= PROFILE_WIND && e->phase <= PROFILE_PARTICLES) ? "simulation" : "render";
+        fprintf(out, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}",
+                profile_phase_names[e->phase], cat, (e->start - prof.origin) * us_per_tick,
+                (e->end - e->start) * us_per_tick);
+    }
+
+    /* Counter tracks for the frames the events cover */
+    unsigned long long frames = prof.num_frames < PROFILE_FRAME_RING ? prof.num_frames : PROFILE_FRAME_RING;
+    for (unsigned long long i = prof.num_frames - frames; i < prof.num_frames; i++) {
+        const ProfileFrame *f = &prof.frames[i % PROFILE_FRAME_RING];
+        if (f->end < first) continue;
+        for (int c = 0; c < PROFILE_NUM_COUNTERS; c++) {
+            fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"args\":{\"value\":%lld}}",
+                    profile_counter_names[c], (f->end - prof.origin) * us_per_tick, f->counters[c]);
+        }
+    }
+    fprintf(out, "\n]}\n");
+    return !ferror(out);
+}
@@ -0,0 +1,94 @@
+/*
+ * storm_profile.h
+ *
+ * Frame profiler.  Each phase of a frame is timed with the performance
+ * counter and recorded into a fixed ring of events; per-frame totals of the
+ * last PROFILE_HISTORY frames give the percentiles shown by the HUD, and a
+ * few counters are sampled once per frame.  Recording costs two counter
+ * reads and a store, so it is always on.  The ring can be written out as
+ * Chrome trace event JSON, which chrome://tracing and Perfetto load.
+ *
+ * Phases are recorded from the main thread only.  The ring's head is
+ * published atomically after each event, so another thread may read the
+ * events up to it without locking.
+ */
+
+#ifndef STORM_PROFILE_H
+#define STORM_PROFILE_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <SDL2/SDL.h>
+
+/* Events kept for the trace; a power of two */
+#define PROFILE_RING 65536
+
+/* Frames kept for the percentiles */
+#define PROFILE_HISTORY 240
+
+/* Frames kept for the counter tracks of the trace */
+#define PROFILE_FRAME_RING 8192
+
+typedef enum {
+    PROFILE_FRAME,            /* The whole main loop iteration */
+    PROFILE_EVENTS,           /* handle_events() */
+    PROFILE_WIND,             /* update_wind() */
+    PROFILE_COLUMNS,          /* update_columns() */
+    PROFILE_LIGHTNING,        /* update_lightning() */
+    PROFILE_PARTICLES,        /* update_particles() */
+    PROFILE_FADE,             /* Trail fade of the canvas, or the clear */
+    PROFILE_GLYPHS,           /* Building and submitting the glyph batch */
+    PROFILE_CANVAS_COPY,      /* Copying the canvas to the screen */
+    PROFILE_DRAW_LIGHTNING,   /* Bolt or flash */
+    PROFILE_HUD,              /* The profiler overlay itself */
+    PROFILE_PRESENT,          /* Present, including any wait for vsync */
+    PROFILE_NUM_PHASES
+} ProfilePhase;
+
+typedef enum {
+    PROFILE_LIVE_COLUMNS,
+    PROFILE_LIVE_PARTICLES,
+    PROFILE_GLYPHS_DRAWN,
+    PROFILE_DRAW_CALLS,
+    PROFILE_SIM_ALLOCATIONS,  /* Heap allocations the simulation made during the frame */
+    PROFILE_NUM_COUNTERS
+} ProfileCounter;
+
+extern const char *const profile_phase_names[PROFILE_NUM_PHASES];
+extern const char *const profile_counter_names[PROFILE_NUM_COUNTERS];
+
+/* Summary of the frames in the history */
+typedef struct {
+    int frames;               /* Frames the percentiles are taken over */
+    float p50_ms[PROFILE_NUM_PHASES];
+    float p99_ms[PROFILE_NUM_PHASES];
+    long long counters[PROFILE_NUM_COUNTERS];  /* Of the last complete frame */
+} ProfileStats;
+
+/* Clear all recordings; trace timestamps count from here */
+void profile_init(void);
+
+static inline Uint64 profile_begin(void) {
+    return SDL_GetPerformanceCounter();
+}
+
+/* Record a phase that began at `start`.  Returns the end time, so
+ * consecutive phases can be chained. */
+Uint64 profile_end(ProfilePhase phase, Uint64 start);
+
+/* Add to a counter of the current frame */
+void profile_count(ProfileCounter counter, long long amount);
+
+/* Close the current frame: fold its phase totals into the history and
+ * sample the counters */
+void profile_frame_end(void);
+
+void profile_stats(ProfileStats *stats);
+
+/* The stats as a JSON object, in a buffer reused by the next call */
+const char *profile_stats_json(void);
+
+/* Write the recorded events and counters as Chrome trace event JSON */
+bool profile_write_trace(FILE *out);
+
+#endif /* STORM_PROFILE_H */
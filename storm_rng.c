@@ -0,0 +1,124 @@
+/*
+ * storm_rng.c
+ *
+ * Seeded random number generators for the simulation.  See storm_rng.h.
+ */
+
+#include <assert.h>
+
+#include "storm_rng.h"
+
+/* Advance a PCG32 generator and return the next 32 random bits */
+uint32_t rng_next(StormRng *rng) {
+    uint64_t old = rng->state;
+    rng->state = old * 6364136223846793005ULL + rng->inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((-rot) & 31));
+}
+
+/* Seed a generator; different streams give unrelated sequences for the same seed */
+void rng_seed(StormRng *rng, uint64_t seed, uint64_t stream) {
+    rng->state = 0;
+    rng->inc = (stream << 1) | 1;
+    rng_next(rng);
+    rng->state += seed;
+    rng_next(rng);
+}
+
+/*
+ * Map 32 random bits to [0, range) with a multiply instead of a modulo
+ * (Lemire's method).  The rare draws that would introduce bias are rejected.
+ * An empty range has no value to return, and its bias threshold would divide
+ * by zero.
+ */
+uint32_t rng_range(StormRng *rng, uint32_t range) {
+    assert(range > 0);
+    uint64_t m = (uint64_t)rng_next(rng) * range;
+    uint32_t low = (uint32_t)m;
+    if (low < range) {
+        uint32_t threshold = -range % range;
+        while (low < threshold) {
+            m = (uint64_t)rng_next(rng) * range;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+float rng_float(StormRng *rng) {
+    return (rng_next(rng) >> 8) * (1.0f / 16777216.0f);
+}
+
+/* Seed every lane from a PCG stream; xorshift state must never be zero */
+void rng_lanes_seed(StormRngLanes *lanes, StormRng *source) {
+    for (int k = 0; k < RNG_LANES; k++) {
+        uint32_t s;
+        do {
+            s = rng_next(source);
+        } while (s == 0);
+        lanes->s[k] = s;
+    }
+}
+
+/* Step one lane (xorshift32 with a multiplicative output scramble) */
+static inline uint32_t lane_next(uint32_t *s) {
+    uint32_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *s = x;
+    return x * 0x2C1B3C6Du;
+}
+
+/* Fill out[0, n) with random bits.  The lanes are independent, so the inner
+ * loop has no carried dependency and vectorizes. */
+void rng_fill(StormRngLanes *lanes, uint32_t *out, size_t n) {
+    uint32_t s[RNG_LANES];
+    for (int k = 0; k < RNG_LANES; k++) s[k] = lanes->s[k];
+
+    size_t i = 0;
+    for (; i + RNG_LANES <= n; i += RNG_LANES) {
+        for (int k = 0; k < RNG_LANES; k++) {
+            out[i + k] = lane_next(&s[k]);
+        }
+    }
+    for (int k = 0; i < n; i++, k++) {
+        out[i] = lane_next(&s[k]);
+    }
+
+    for (int k = 0; k < RNG_LANES; k++) lanes->s[k] = s[k];
+}
+
+/*
+ * Fill out[0, n) with indices uniform in [0, range).  The bias test and the
+ * multiply-shift reduction each run over the whole array in one branch-free
+ * pass; only if some draw falls into the biased region (probability
+ * range / 2^32 per draw) is the array mapped by the scalar rejection loop.
+ */
+void rng_fill_indices(StormRngLanes *lanes, int *out, size_t n, uint32_t range) {
+    assert(range > 0);
+    uint32_t *bits = (uint32_t *)out;
+    uint32_t threshold = -range % range;
+    rng_fill(lanes, bits, n);
+
+    uint32_t biased = 0;
+    for (size_t i = 0; i < n; i++) {
+        biased |= (uint32_t)((uint32_t)((uint64_t)bits[i] * range) < threshold);
+    }
+
+    if (!biased) {
+        for (size_t i = 0; i < n; i++) {
+            out[i] = (int)(((uint64_t)bits[i] * range) >> 32);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        uint64_t m = (uint64_t)bits[i] * range;
+        while ((uint32_t)m < threshold) {
+            m = (uint64_t)lane_next(&lanes->s[i % RNG_LANES]) * range;
+        }
+        out[i] = (int)(m >> 32);
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * storm_rng.h
+ *
+ * Small seeded random number generators for the simulation.
+ *
+ * StormRng is a PCG32 generator; each subsystem owns its own stream, so the
+ * sequence seen by one (e.g. wind) does not depend on how many numbers
+ * another (e.g. lightning) has drawn.  StormRngLanes runs several
+ * independent xorshift generators side by side and fills whole arrays in
+ * one pass that the compiler can vectorize.
+ */
+
+#ifndef STORM_RNG_H
+#define STORM_RNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Number of independent generators in a StormRngLanes */
+#define RNG_LANES 8
+
+/* PCG32 generator: 64-bit state, stream selected by the odd increment */
+typedef struct {
+    uint64_t state;
+    uint64_t inc;
+} StormRng;
+
+/* Interleaved xorshift generators for bulk fills */
+typedef struct {
+    uint32_t s[RNG_LANES];
+} StormRngLanes;
+
+/* Single values */
+void rng_seed(StormRng *rng, uint64_t seed, uint64_t stream);
+uint32_t rng_next(StormRng *rng);
+uint32_t rng_range(StormRng *rng, uint32_t range);  /* Uniform in [0, range), range > 0, without modulo bias */
+float rng_float(StormRng *rng);                     /* Uniform in [0, 1) */
+
+/* Bulk fills */
+void rng_lanes_seed(StormRngLanes *lanes, StormRng *source);
+void rng_fill(StormRngLanes *lanes, uint32_t *out, size_t n);
+void rng_fill_indices(StormRngLanes *lanes, int *out, size_t n, uint32_t range);
+
+#endif /* STORM_RNG_H */
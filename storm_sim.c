@@ -0,0 +1,2297 @@
+/*
+ * storm_sim.c
+ *
+ * Simulation and geometry for the Matrix Rain effect: falling columns, wind,
+ * lightning and splashes.  See storm_sim.h.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "storm_sim.h"
+#include "storm_pool.h"
+#include "storm_profile.h"
+
+/* SIMD instruction set for the column physics kernel, chosen at compile time.
+ * Define MATRIX_NO_SIMD to force the scalar reference path.
+ */
+#if !defined(MATRIX_NO_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define COLUMN_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define COLUMN_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define COLUMN_SIMD_NEON
+#elif defined(__wasm_simd128__)
+#include <wasm_simd128.h>
+#define COLUMN_SIMD_WASM
+#endif
+#endif
+
+/* Unicode Characters */
+
+/* List of Unicode characters: Hiragana, Katakana, Latin, Cyrillic, Numbers,
+   Math symbols, Greek Alphabet, and Chinese characters. */
+const char *unicode_chars[] = {
+    /* Hiragana */
+    "あ", "い", "う", "え", "お",
+    "か", "き", "く", "け", "こ",
+    "さ", "し", "す", "せ", "そ",
+    "た", "ち", "つ", "て", "と",
+    "な", "に", "ぬ", "ね", "の",
+    "は", "ひ", "ふ", "へ", "ほ",
+    "ま", "み", "む", "め", "も",
+    "や", "ゆ", "よ",
+    "ら", "り", "る", "れ", "ろ",
+    "わ", "を", "ん",
+    
+    /* Katakana */
+    "ア", "イ", "ウ", "エ", "オ",
+    "カ", "キ", "ク", "ケ", "コ",
+    "サ", "シ", "ス", "セ", "ソ",
+    "タ", "チ", "ツ", "テ", "ト",
+    "ナ", "ニ", "ヌ", "ネ", "ノ",
+    "ハ", "ヒ", "フ", "ヘ", "ホ",
+    "マ", "ミ", "ム", "メ", "モ",
+    "ヤ", "ユ", "ヨ",
+    "ラ", "リ", "ル", "レ", "ロ",
+    "ワ", "ヲ", "ン",
+    
+    /* Latin */
+    "A", "B", "C", "D", "E", "F", "G", "H", "I", 
+    "J", "K", "L", "M", "N", "O", "P", "Q", "R", 
+    "S", "T", "U", "V", "W", "X", "Y", "Z", 
+    "a", "b", "c", "d", "e", "f", "g", "h", "i", 
+    "j", "k", "l", "m", "n", "o", "p", "q", "r", 
+    "s", "t", "u", "v", "w", "x", "y", "z",
+    
+    /* Cyrillic */
+    "Б", "Д", "Ж", "З", "И", "Л", "У", "Ц", 
+    "Ч", "Ш", "Щ", "Ъ", "Ь", "Э", "Ю", "Я",
+    
+    /* Numbers */
+    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+    
+    /* Math symbols */
+    "+", "-", "×", "÷", "=", "≠", "≤", "≥", "±", 
+    "∑", "∏", "√", "∞", "∫", "∂", "∆", "∇", "∈", 
+    "∉", "∋", "∅", "∧", "∨", "⊕", "⊗", "⊆", "⊇", 
+    "∝", "∴", "∵", "∃", "∀", "∩", "∪", "≈", "≅",
+    
+    /* Greek Alphabet */
+    "Α", "Β", "Γ", "Δ", "Θ", "Ι", "Λ", "Ξ", "Π", 
+    "Σ", "Φ", "Ψ", "Ω", "α", "β", "γ", "δ", "ε", 
+    "ζ", "η", "θ", "ι", "κ", "λ", "μ", "ν", "ξ", 
+    "ο", "π", "ρ", "σ", "τ", "υ", "φ", "χ", "ψ", "ω",
+    
+    /* Chinese Characters */
+    "你", "好", "我", "是", "天", "地", "人", "山", "水", "火", 
+    "大", "小", "中", "国", "学", "生", "爱", "书", "车", "猫", 
+    "狗", "月", "日", "年", "风", "雨", "花", "草", "树", "家",
+    "鼠", "牛", "虎", "兔", "龙", "蛇", "马", "羊", "猴", "鸡", 
+    "猪", "星", "空", "光", "影", "梦", "夜", "晨", "时", "钟", 
+    "金", "银", "玉", "石", "海", "湖", "江", "河", "山", "川",
+};
+
+
+_Static_assert(sizeof(unicode_chars) / sizeof(unicode_chars[0]) == NUM_UNICODE_CHARS,
+               "NUM_UNICODE_CHARS must match the unicode_chars table");
+
+/* Global Variables */
+
+/* Global window dimensions */
+int g_screen_width = 800;
+int g_screen_height = 600;
+
+int char_width, char_height;     /* Character dimensions (monospace) */
+
+/* Active falling columns */
+ColumnPool columns = { 0 };
+float column_density = 3.0f;
+int column_cap = COLUMN_CAP_DEFAULT;
+int column_margin_chars = 50;
+float glyph_update_interval = 0.1f;
+
+GlyphStream glyph_stream = { 0 };
+float glyph_tail_fade = 0.0f;
+float glyph_ghost_alpha = 0.0f;
+
+LightningPool lightning = { 0 };
+int lightning_detail = 0;
+float lightning_rate = LIGHTNING_RATE_DEFAULT;
+float lightning_illumination = 0.7f;
+
+ParticlePool particles = { 0 };
+int splash_fragments = SPLASH_FRAGMENTS_DEFAULT;
+
+/* Wind effect variables */
+float current_wind_angle = 0.0f;       /* Current wind angle (degrees) */
+float target_wind_angle = 0.0f;        /* Target wind angle (degrees) */
+float wind_start_angle = 0.0f;         /* Wind angle at transition start */
+float wind_idle_timer = 3.0f;          /* Idle duration before wind change */
+float wind_transition_timer = 0.0f;    /* Timer during wind transition */
+float wind_transition_duration = 0.0f; /* Transition duration */
+bool wind_in_transition = false;       /* Flag: wind is transitioning */
+float wind_gust_rate = WIND_GUST_RATE_DEFAULT;
+
+StormRng rng_columns, rng_wind, rng_lightning, rng_gusts, rng_splash;
+StormRngLanes glyph_lanes;       /* Bulk glyph and mutation mask generator */
+
+/* Spawn scheduler: fractional spawns owed, and the position in the
+ * golden-ratio sequence that spreads spawns across the span */
+static float spawn_budget = 0.0f;
+static float spawn_phase = 0.0f;
+
+/* Seconds over which a shortfall of columns is made up, and the shortest
+ * time in which an empty span may be filled to its target */
+#define SPAWN_RESPONSE_TIME 1.0f
+#define SPAWN_RAMP_TIME 8.0f
+
+/* Columns per unit of work handed to the worker pool */
+#define COLUMN_CHUNK 2048
+
+/* Most instances a column can emit: every glyph plus a ghost */
+#define COLUMN_MAX_INSTANCES (MAX_COLUMN_LENGTH + 1)
+
+/* Splashes: spray speed of a glyph hitting the ground in pixels/s and the
+ * share of the column's drift its fragments keep; fragments, speed and
+ * reach of a lightning strike */
+#define SPLASH_SPEED 160.0f
+#define SPLASH_CARRY 0.25f
+#define SPLASH_STRIKE_FRAGMENTS 12
+#define SPLASH_STRIKE_SPEED 360.0f
+#define SPLASH_STRIKE_RADIUS (LIGHTNING_LIGHT_RADIUS * 0.25f)
+
+/* Splash particle physics: gravity in pixels/s^2, the shares of vertical
+ * and horizontal speed a bounce keeps, and the fastest spin in radians/s */
+#define PARTICLE_GRAVITY 600.0f
+#define PARTICLE_RESTITUTION 0.35f
+#define PARTICLE_FRICTION 0.6f
+#define PARTICLE_MAX_SPIN 12.0f
+
+/* A column that splashes this step: glyphs [first, first + count) reached
+ * the ground, and/or a fresh bolt struck near its head */
+typedef struct {
+    int column;
+    int first, count;
+    bool struck;
+} SplashEvent;
+
+/* Emission results of one chunk */
+typedef struct {
+    size_t instances;
+    size_t offset;            /* Position of the chunk's instances in glyph_stream */
+    size_t columns_drawn, columns_culled, glyphs_culled;
+} ChunkEmit;
+
+/*
+ * Per-step scratch lists, grown with the column pool.  Chunk k of a step
+ * writes its due and dead columns to slots [k * COLUMN_CHUNK, ...) of `due`
+ * and `dead`, so workers never share a list and the merge at the end of the
+ * step visits columns in slot order no matter which worker ran which chunk.
+ * Glyph instances work the same way, with COLUMN_MAX_INSTANCES slots per
+ * column, and are compacted into glyph_stream after the parallel pass.
+ * Splash events follow the due and dead lists.
+ */
+static struct {
+    int *due;                    /* Columns whose characters change this step */
+    int *dead;                   /* Columns culled this step */
+    int *chunk_due;              /* Number of due columns per chunk */
+    int *chunk_dead;             /* Number of dead columns per chunk */
+    SplashEvent *splashes;       /* Columns that splash this step */
+    int *chunk_splashes;         /* Number of splashing columns per chunk */
+    uint32_t *masks;             /* One bit per character: replace it or not */
+    int *glyphs;                 /* Replacement glyphs, `length` per due column */
+    ChunkEmit *chunk_emit;       /* Instances and culling counts per chunk */
+    int *inst_first;             /* First instance of a column within its chunk; -1 if none */
+    int *inst_j0;                /* Character the column's first instance shows */
+    int *inst_count;             /* Number of instances of a column */
+    size_t due_capacity;
+    size_t glyph_capacity;
+} scratch;
+
+/* One bolt segment as listed in the light grid */
+typedef struct {
+    float ax, ay;             /* Start */
+    float dx, dy;             /* End minus start */
+    float inv_length2;        /* 1 / |d|^2, or 0 for a zero-length segment */
+    int slot;                 /* Slot of the bolt */
+} LightSegment;
+
+/* Cell size of the light grid, longest light segment, and how far in
+ * pixels a bolt point a light segment skips may stray from it */
+#define LIGHT_CELL_SIZE (LIGHTNING_LIGHT_RADIUS * 0.5f)
+#define LIGHT_SEGMENT_LENGTH (LIGHTNING_LIGHT_RADIUS * 0.5f)
+#define LIGHT_SEGMENT_TOLERANCE 4.0f
+
+/*
+ * Uniform grid over the light segments of the live bolts.  Every segment
+ * is listed in each cell that comes within LIGHTNING_LIGHT_RADIUS of it, so
+ * the segments that can light a point are among those of the point's own
+ * cell: a query reads one cell range, however many bolts are live.
+ * Rebuilt between steps whenever a bolt spawns or expires; the arrays only
+ * grow.
+ */
+static struct {
+    bool dirty;               /* The set of bolts changed since the last build */
+    int num_bolts;            /* Bolts in the grid */
+    int cols, rows;
+    int *cell_start;          /* cols * rows + 1 offsets into entries */
+    int *cell_fill;           /* Insertion cursors while building */
+    size_t cell_capacity;
+    int *entries;             /* Indices into segments, grouped by cell */
+    size_t num_entries, entry_capacity;
+    LightSegment *segments;
+    size_t num_segments, segment_capacity;
+    float fade[LIGHTNING_SLOTS];  /* Brightness of each slot's bolt this step */
+    uint32_t spawned;         /* Slots whose bolt spawned since the last step */
+    uint32_t fresh;           /* Slots whose bolt spawned just before this step */
+} light;
+
+/* A gust or a vortex of the wind field */
+typedef struct {
+    float x, y;               /* Center in pixels */
+    float vx, vy;             /* Drift in pixels/s */
+    float radius;
+    float strength;           /* Peak change of the drift slope; the sign is the direction */
+    float age, lifetime;      /* Seconds */
+    bool vortex;              /* Swirl around the center rather than push one way */
+} WindFeature;
+
+/* One node of the wind field */
+typedef struct {
+    float slope;              /* Target vx / vy of the columns */
+    float gain;               /* Multiplier of WIND_RESPONSE, 0 to 1 */
+} WindNode;
+
+/* Field of a single calm cell, in use until the first build */
+static WindNode calm_nodes[4];
+
+/*
+ * Coarse wind field over the screen, WIND_CELL_SIZE pixels per cell.  The
+ * angle schedule of update_wind() gives the base drift, the wave front of a
+ * transition gives the gain along x, and the gusts and vortices add to
+ * both.  Rebuilt at the end of update_wind() while anything in it changes;
+ * a settled field is left alone.  Positions off the grid take the value at
+ * its nearest edge.  Nodes hold both quantities side by side, so the two
+ * corners of a cell on one row are 16 contiguous bytes, and the field of a
+ * 4K screen (about 17 KB) stays in the L1 cache.  The array only grows.
+ */
+static struct {
+    int cols, rows;           /* Cells; there is one more node each way */
+    float max_u, max_v;       /* Largest cell coordinates a sample takes */
+    WindNode *nodes;          /* (cols + 1) * (rows + 1), row by row */
+    size_t node_capacity;     /* 0 while nodes is calm_nodes */
+    bool settled;             /* Built, uniform and up to date with the angle */
+    WindFeature features[WIND_MAX_FEATURES];
+    int num_features;
+} wind = { .cols = 1, .rows = 1, .max_u = 0.999f, .max_v = 0.999f, .nodes = calm_nodes };
+
+unsigned long long sim_steps = 0;
+unsigned long sim_allocations = 0;
+
+/* Utility Functions */
+
+/* Counting wrappers for every allocation made by the simulation */
+static void *storm_malloc(size_t size) {
+    sim_allocations++;
+    return malloc(size);
+}
+
+static void *storm_realloc(void *ptr, size_t size) {
+    sim_allocations++;
+    return realloc(ptr, size);
+}
+
+/* Returns a random index for the unicode_chars array */
+int random_unicode_index(void) {
+    return (int)rng_range(&rng_columns, NUM_UNICODE_CHARS);
+}
+
+/* Grow the column pool to hold at least `capacity` columns */
+bool reserve_columns(size_t capacity) {
+    if (capacity <= columns.capacity)
+        return true;
+    size_t new_capacity = (columns.capacity == 0) ? 16 : columns.capacity;
+    while (new_capacity < capacity)
+        new_capacity *= 2;
+
+    float **float_arrays[] = { &columns.x, &columns.y, &columns.prev_x, &columns.prev_y,
+                               &columns.vx, &columns.vy, &columns.depth, &columns.char_update_timer };
+    for (size_t i = 0; i < sizeof(float_arrays) / sizeof(float_arrays[0]); i++) {
+        float *grown = storm_realloc(*float_arrays[i], new_capacity * sizeof(float));
+        if (!grown) return false;
+        *float_arrays[i] = grown;
+    }
+    int *grown_length = storm_realloc(columns.length, new_capacity * sizeof(int));
+    if (!grown_length) return false;
+    columns.length = grown_length;
+    unsigned char *grown_alive = storm_realloc(columns.alive, new_capacity);
+    if (!grown_alive) return false;
+    columns.alive = grown_alive;
+    int *grown_indices = storm_realloc(columns.indices, new_capacity * MAX_COLUMN_LENGTH * sizeof(int));
+    if (!grown_indices) return false;
+    columns.indices = grown_indices;
+
+    int *grown_due = storm_realloc(scratch.due, new_capacity * sizeof(int));
+    if (!grown_due) return false;
+    scratch.due = grown_due;
+    int *grown_dead = storm_realloc(scratch.dead, new_capacity * sizeof(int));
+    if (!grown_dead) return false;
+    scratch.dead = grown_dead;
+    SplashEvent *grown_splashes = storm_realloc(scratch.splashes, new_capacity * sizeof(SplashEvent));
+    if (!grown_splashes) return false;
+    scratch.splashes = grown_splashes;
+    size_t max_chunks = new_capacity / COLUMN_CHUNK + 1;
+    int *grown_chunk_due = storm_realloc(scratch.chunk_due, max_chunks * sizeof(int));
+    if (!grown_chunk_due) return false;
+    scratch.chunk_due = grown_chunk_due;
+    int *grown_chunk_dead = storm_realloc(scratch.chunk_dead, max_chunks * sizeof(int));
+    if (!grown_chunk_dead) return false;
+    scratch.chunk_dead = grown_chunk_dead;
+    int *grown_chunk_splashes = storm_realloc(scratch.chunk_splashes, max_chunks * sizeof(int));
+    if (!grown_chunk_splashes) return false;
+    scratch.chunk_splashes = grown_chunk_splashes;
+    uint32_t *grown_masks = storm_realloc(scratch.masks, new_capacity * sizeof(uint32_t));
+    if (!grown_masks) return false;
+    scratch.masks = grown_masks;
+    scratch.due_capacity = new_capacity;
+    ChunkEmit *grown_emit = storm_realloc(scratch.chunk_emit, max_chunks * sizeof(ChunkEmit));
+    if (!grown_emit) return false;
+    scratch.chunk_emit = grown_emit;
+    int *grown_first = storm_realloc(scratch.inst_first, new_capacity * sizeof(int));
+    if (!grown_first) return false;
+    scratch.inst_first = grown_first;
+    int *grown_j0 = storm_realloc(scratch.inst_j0, new_capacity * sizeof(int));
+    if (!grown_j0) return false;
+    scratch.inst_j0 = grown_j0;
+    int *grown_count = storm_realloc(scratch.inst_count, new_capacity * sizeof(int));
+    if (!grown_count) return false;
+    scratch.inst_count = grown_count;
+    GlyphInstance *grown_instances = storm_realloc(glyph_stream.instances,
+                                                   new_capacity * COLUMN_MAX_INSTANCES * sizeof(GlyphInstance));
+    if (!grown_instances) return false;
+    glyph_stream.instances = grown_instances;
+
+    columns.capacity = new_capacity;
+    return true;
+}
+
+/* Release all memory held by the column pool */
+void free_columns(void) {
+    free(columns.x);
+    free(columns.y);
+    free(columns.prev_x);
+    free(columns.prev_y);
+    free(columns.vx);
+    free(columns.vy);
+    free(columns.depth);
+    free(columns.char_update_timer);
+    free(columns.length);
+    free(columns.alive);
+    free(columns.indices);
+    memset(&columns, 0, sizeof(columns));
+    free(scratch.due);
+    free(scratch.dead);
+    free(scratch.chunk_due);
+    free(scratch.chunk_dead);
+    free(scratch.splashes);
+    free(scratch.chunk_splashes);
+    free(scratch.masks);
+    free(scratch.glyphs);
+    free(scratch.chunk_emit);
+    free(scratch.inst_first);
+    free(scratch.inst_j0);
+    free(scratch.inst_count);
+    memset(&scratch, 0, sizeof(scratch));
+    free(glyph_stream.instances);
+    memset(&glyph_stream, 0, sizeof(glyph_stream));
+}
+
+/* Spawn a new falling column at the given horizontal position.
+ * Returns the slot of the new column, or -1 if column_cap is reached or the
+ * pool could not grow.  With the pool reserved up to column_cap, spawning
+ * only ever refills slots freed by destroy_column().
+ */
+int create_column(int col_index) {
+    if (columns.count >= (size_t)column_cap || !reserve_columns(columns.count + 1))
+        return -1;
+    size_t c = columns.count++;
+    columns.x[c] = (float)col_index;
+    columns.y[c] = -(float)rng_range(&rng_columns, g_screen_height);
+    columns.length[c] = 5 + (int)rng_range(&rng_columns, 23);
+    columns.depth[c] = (float)rng_range(&rng_columns, 101) / 100.0f;
+    columns.char_update_timer[c] = 0.0f;
+    columns.alive[c] = 1;
+    rng_fill_indices(&glyph_lanes, &columns.indices[c * MAX_COLUMN_LENGTH], columns.length[c],
+                     NUM_UNICODE_CHARS);
+    /* Initialize vertical speed (50-200 pixels/s); no horizontal speed */
+    columns.vy[c] = 50.0f + (float)rng_range(&rng_columns, 150);
+    columns.vx[c] = 0.0f;
+    columns.prev_x[c] = columns.x[c];
+    columns.prev_y[c] = columns.y[c];
+    return (int)c;
+}
+
+/*
+ * Narrow the glyph range [*j0, *j1) of a column to the glyphs j whose
+ * coordinate start + j * step along one axis lies within [lo, hi].  Solved
+ * in closed form, so a column costs the same however many of its glyphs are
+ * off-screen; an empty result leaves *j0 >= *j1.  The bounds are widened by
+ * a hair against rounding, so callers needing an exact test still apply it
+ * to the glyphs in range.
+ */
+void clip_glyph_run(float start, float step, float lo, float hi, int *j0, int *j1) {
+    const float eps = 1e-4f;
+    if (step == 0.0f) {
+        if (start < lo || start > hi) *j1 = *j0;
+        return;
+    }
+    float a = (lo - start) / step;
+    float b = (hi - start) / step;
+    if (step < 0.0f) {
+        float t = a; a = b; b = t;
+    }
+    /* Clamp before converting so far off-screen columns cannot overflow */
+    float min_j = (float)*j0 - 1.0f, max_j = (float)*j1;
+    a = a < min_j ? min_j : (a > max_j ? max_j : a);
+    b = b < min_j ? min_j : (b > max_j ? max_j : b);
+    int first = (int)ceilf(a - eps);
+    int last = (int)floorf(b + eps) + 1;
+    if (first > *j0) *j0 = first;
+    if (last < *j1) *j1 = last;
+}
+
+/* Remove a column by moving the last live column into its slot */
+void destroy_column(size_t c) {
+    size_t last = --columns.count;
+    if (c == last)
+        return;
+    columns.x[c] = columns.x[last];
+    columns.y[c] = columns.y[last];
+    columns.prev_x[c] = columns.prev_x[last];
+    columns.prev_y[c] = columns.prev_y[last];
+    columns.vx[c] = columns.vx[last];
+    columns.vy[c] = columns.vy[last];
+    columns.depth[c] = columns.depth[last];
+    columns.char_update_timer[c] = columns.char_update_timer[last];
+    columns.length[c] = columns.length[last];
+    columns.alive[c] = columns.alive[last];
+    memcpy(&columns.indices[c * MAX_COLUMN_LENGTH], &columns.indices[last * MAX_COLUMN_LENGTH],
+           columns.length[last] * sizeof(int));
+}
+
+/* Per-frame inputs of the column physics kernel */
+typedef struct {
+    float delta;              /* Time step in seconds */
+    float char_height;        /* Distance between successive characters */
+    float min_x, max_x;       /* Horizontal retention bounds */
+    float min_y, max_y;       /* Vertical retention bounds */
+} ColumnKernelParams;
+
+/*
+ * Wave front of a wind transition, as the gain clamp(1 - slope * (x - front),
+ * 0, 1) at horizontal position x.  If the wind is increasing (target angle
+ * above the start angle) it comes from the left and the front moves right;
+ * if it is decreasing it comes from the right.  The zone over which the gain
+ * ramps from 1 to 0 is shorter for larger changes of angle.  A slope of 0
+ * yields the full effect everywhere, which is the behavior outside of a
+ * transition.
+ */
+static void get_wind_front(float *front, float *slope) {
+    *front = 0.0f;
+    *slope = 0.0f;
+    if (!wind_in_transition)
+        return;
+
+    float wave_progress = wind_transition_timer / wind_transition_duration;
+    float zone = 50.0f - (fabsf(target_wind_angle - wind_start_angle) * 0.2f);
+    if (zone < 10.0f)
+        zone = 10.0f;
+    if (target_wind_angle > wind_start_angle) {
+        *front = wave_progress * g_screen_width;
+        *slope = 1.0f / zone;
+    } else {
+        *front = g_screen_width - (wave_progress * g_screen_width);
+        *slope = -1.0f / zone;
+    }
+}
+
+/* Top-left node of the cell holding (x, y) and the position within it */
+static inline const WindNode *wind_cell(float x, float y, float *fx, float *fy) {
+    float u = x * (1.0f / WIND_CELL_SIZE), v = y * (1.0f / WIND_CELL_SIZE);
+    u = u < 0.0f ? 0.0f : u > wind.max_u ? wind.max_u : u;
+    v = v < 0.0f ? 0.0f : v > wind.max_v ? wind.max_v : v;
+    int c = (int)u, r = (int)v;
+    *fx = u - (float)c;
+    *fy = v - (float)r;
+    return &wind.nodes[r * (wind.cols + 1) + c];
+}
+
+/* Bilinear sample of the wind field at (x, y) */
+static inline void sample_wind(float x, float y, float *slope, float *gain) {
+    float fx, fy;
+    const WindNode *n = wind_cell(x, y, &fx, &fy);
+    const WindNode *s = n + wind.cols + 1;
+    float top = n[0].slope + (n[1].slope - n[0].slope) * fx;
+    float bottom = s[0].slope + (s[1].slope - s[0].slope) * fx;
+    *slope = top + (bottom - top) * fy;
+    top = n[0].gain + (n[1].gain - n[0].gain) * fx;
+    bottom = s[0].gain + (s[1].gain - s[0].gain) * fx;
+    *gain = top + (bottom - top) * fy;
+}
+
+/* Columns whose wind is sampled at a time, ahead of their physics */
+#define WIND_BATCH 64
+
+/* Scalar reference kernel: gravity, wind, integration and culling for the
+ * columns in [begin, end).  Writes the retention decision to columns.alive.
+ */
+static void column_physics_scalar(const ColumnKernelParams *p, size_t begin, size_t end) {
+    float delta = p->delta;
+    float wind_slope[WIND_BATCH], wind_gain[WIND_BATCH];
+    for (size_t i = begin; i < end; i++) {
+        /* Sample the wind of a batch of columns ahead.  Apart, the samples
+         * overlap; inside this loop each one would add its latency to the
+         * column's chain of library calls. */
+        size_t k = (i - begin) % WIND_BATCH;
+        if (k == 0) {
+            size_t n = end - i < WIND_BATCH ? end - i : WIND_BATCH;
+            for (size_t j = 0; j < n; j++)
+                sample_wind(columns.x[i + j], columns.y[i + j], &wind_slope[j], &wind_gain[j]);
+        }
+
+        /* Apply gravity */
+        columns.vy[i] += GRAVITY * delta;
+        if (columns.vy[i] > TERMINAL_VELOCITY)
+            columns.vy[i] = TERMINAL_VELOCITY;
+
+        /* Relax the horizontal velocity towards the drift of the local wind */
+        float target_vx = wind_slope[k] * columns.vy[i];
+        columns.vx[i] += (target_vx - columns.vx[i]) * WIND_RESPONSE * wind_gain[k] * delta;
+
+        /* Update position */
+        columns.x[i] += columns.vx[i] * delta;
+        columns.y[i] += columns.vy[i] * delta;
+
+        /* Compute fall angle and cache sine and cosine values */
+        float fall_angle = atan2(columns.vx[i], columns.vy[i]);
+        float dx = -p->char_height * sinf(fall_angle);
+        float dy = -p->char_height * cosf(fall_angle);
+
+        /* Calculate bounding box for the column */
+        float letter0_x = columns.x[i];
+        float letter_end_x = columns.x[i] + (columns.length[i] - 1) * dx;
+        float min_x = (letter0_x < letter_end_x) ? letter0_x : letter_end_x;
+        float max_x = (letter0_x > letter_end_x) ? letter0_x : letter_end_x;
+
+        float letter0_y = columns.y[i];
+        float letter_end_y = columns.y[i] + (columns.length[i] - 1) * dy;
+        float min_y = (letter0_y < letter_end_y) ? letter0_y : letter_end_y;
+        float max_y = (letter0_y > letter_end_y) ? letter0_y : letter_end_y;
+
+        columns.alive[i] = max_y >= p->min_y && min_y <= p->max_y &&
+                           max_x >= p->min_x && min_x <= p->max_x;
+    }
+}
+
+/*
+ * Vector abstraction for the SIMD kernel.  Each instruction set maps the same
+ * small set of operations, so the kernel below is written only once.
+ */
+#if defined(COLUMN_SIMD_AVX2)
+#define COLUMN_KERNEL_NAME "avx2"
+#define VF_WIDTH 8
+typedef __m256 vfloat;
+typedef __m256 vmask;
+#define vf_load(p)        _mm256_loadu_ps(p)
+#define vf_load_int(p)    _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(p)))
+#define vf_store(p, v)    _mm256_storeu_ps(p, v)
+#define vf_set1(x)        _mm256_set1_ps(x)
+#define vf_add(a, b)      _mm256_add_ps(a, b)
+#define vf_sub(a, b)      _mm256_sub_ps(a, b)
+#define vf_mul(a, b)      _mm256_mul_ps(a, b)
+#define vf_div(a, b)      _mm256_div_ps(a, b)
+#define vf_min(a, b)      _mm256_min_ps(a, b)
+#define vf_max(a, b)      _mm256_max_ps(a, b)
+#define vf_sqrt(a)        _mm256_sqrt_ps(a)
+#define vf_trunc(a)       _mm256_round_ps(a, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC)
+#define vf_store_int(p, v) _mm256_storeu_si256((__m256i *)(p), _mm256_cvttps_epi32(v))
+#define vf_cmpge(a, b)    _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+#define vf_cmple(a, b)    _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+#define vf_select(m, a, b) _mm256_blendv_ps(b, a, m)
+#define vm_and(a, b)      _mm256_and_ps(a, b)
+#define vm_bits(m)        _mm256_movemask_ps(m)
+#elif defined(COLUMN_SIMD_SSE2)
+#define COLUMN_KERNEL_NAME "sse2"
+#define VF_WIDTH 4
+typedef __m128 vfloat;
+typedef __m128 vmask;
+#define vf_load(p)        _mm_loadu_ps(p)
+#define vf_load_int(p)    _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(p)))
+#define vf_store(p, v)    _mm_storeu_ps(p, v)
+#define vf_set1(x)        _mm_set1_ps(x)
+#define vf_add(a, b)      _mm_add_ps(a, b)
+#define vf_sub(a, b)      _mm_sub_ps(a, b)
+#define vf_mul(a, b)      _mm_mul_ps(a, b)
+#define vf_div(a, b)      _mm_div_ps(a, b)
+#define vf_min(a, b)      _mm_min_ps(a, b)
+#define vf_max(a, b)      _mm_max_ps(a, b)
+#define vf_sqrt(a)        _mm_sqrt_ps(a)
+#define vf_trunc(a)       _mm_cvtepi32_ps(_mm_cvttps_epi32(a))
+#define vf_store_int(p, v) _mm_storeu_si128((__m128i *)(p), _mm_cvttps_epi32(v))
+#define vf_cmpge(a, b)    _mm_cmpge_ps(a, b)
+#define vf_cmple(a, b)    _mm_cmple_ps(a, b)
+#define vf_select(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#define vm_and(a, b)      _mm_and_ps(a, b)
+#define vm_bits(m)        _mm_movemask_ps(m)
+#elif defined(COLUMN_SIMD_NEON)
+#define COLUMN_KERNEL_NAME "neon"
+#define VF_WIDTH 4
+typedef float32x4_t vfloat;
+typedef uint32x4_t vmask;
+#define vf_load(p)        vld1q_f32(p)
+#define vf_load_int(p)    vcvtq_f32_s32(vld1q_s32(p))
+#define vf_store(p, v)    vst1q_f32(p, v)
+#define vf_set1(x)        vdupq_n_f32(x)
+#define vf_add(a, b)      vaddq_f32(a, b)
+#define vf_sub(a, b)      vsubq_f32(a, b)
+#define vf_mul(a, b)      vmulq_f32(a, b)
+#define vf_div(a, b)      vdivq_f32(a, b)
+#define vf_min(a, b)      vminq_f32(a, b)
+#define vf_max(a, b)      vmaxq_f32(a, b)
+#define vf_sqrt(a)        vsqrtq_f32(a)
+#define vf_trunc(a)       vrndq_f32(a)
+#define vf_store_int(p, v) vst1q_s32(p, vcvtq_s32_f32(v))
+#define vf_cmpge(a, b)    vcgeq_f32(a, b)
+#define vf_cmple(a, b)    vcleq_f32(a, b)
+#define vf_select(m, a, b) vbslq_f32(m, a, b)
+#define vm_and(a, b)      vandq_u32(a, b)
+static inline int vm_bits(uint32x4_t m) {
+    const int32x4_t shift = { 0, 1, 2, 3 };
+    return (int)vaddvq_u32(vshlq_u32(vshrq_n_u32(m, 31), shift));
+}
+#elif defined(COLUMN_SIMD_WASM)
+#define COLUMN_KERNEL_NAME "simd128"
+#define VF_WIDTH 4
+typedef v128_t vfloat;
+typedef v128_t vmask;
+#define vf_load(p)        wasm_v128_load(p)
+#define vf_load_int(p)    wasm_f32x4_convert_i32x4(wasm_v128_load(p))
+#define vf_store(p, v)    wasm_v128_store(p, v)
+#define vf_set1(x)        wasm_f32x4_splat(x)
+#define vf_add(a, b)      wasm_f32x4_add(a, b)
+#define vf_sub(a, b)      wasm_f32x4_sub(a, b)
+#define vf_mul(a, b)      wasm_f32x4_mul(a, b)
+#define vf_div(a, b)      wasm_f32x4_div(a, b)
+#define vf_min(a, b)      wasm_f32x4_pmin(a, b)
+#define vf_max(a, b)      wasm_f32x4_pmax(a, b)
+#define vf_sqrt(a)        wasm_f32x4_sqrt(a)
+#define vf_trunc(a)       wasm_f32x4_trunc(a)
+#define vf_store_int(p, v) wasm_v128_store(p, wasm_i32x4_trunc_sat_f32x4(v))
+#define vf_cmpge(a, b)    wasm_f32x4_ge(a, b)
+#define vf_cmple(a, b)    wasm_f32x4_le(a, b)
+#define vf_select(m, a, b) wasm_v128_bitselect(a, b, m)
+#define vm_and(a, b)      wasm_v128_and(a, b)
+#define vm_bits(m)        ((int)wasm_i32x4_bitmask(m))
+#else
+#define COLUMN_KERNEL_NAME "scalar"
+#endif
+
+#ifdef VF_WIDTH
+/* Corners of the wind cells of a batch of columns, one array per corner
+ * (top-left, top-right, bottom-left, bottom-right) and quantity */
+typedef struct {
+    float slope[4][WIND_BATCH];
+    float gain[4][WIND_BATCH];
+    float fx[WIND_BATCH], fy[WIND_BATCH];
+} WindBatch;
+
+/*
+ * Fetch the wind cells of columns [begin, begin + n) for the vector loop.
+ * Gathering a whole batch ahead of the loop, rather than a vector's worth
+ * at a time, lets the scalar stores retire before they are read back as
+ * vectors.
+ */
+static void gather_wind(size_t begin, size_t n, WindBatch *b) {
+    const vfloat zero = vf_set1(0.0f), inv_cell = vf_set1(1.0f / WIND_CELL_SIZE);
+    const vfloat max_u = vf_set1(wind.max_u), max_v = vf_set1(wind.max_v);
+    const vfloat stride = vf_set1((float)(wind.cols + 1));
+    int node[WIND_BATCH];
+    for (size_t k = 0; k < n; k += VF_WIDTH) {
+        vfloat u = vf_min(vf_max(vf_mul(vf_load(&columns.x[begin + k]), inv_cell), zero), max_u);
+        vfloat v = vf_min(vf_max(vf_mul(vf_load(&columns.y[begin + k]), inv_cell), zero), max_v);
+        vfloat c = vf_trunc(u), r = vf_trunc(v);
+        vf_store(&b->fx[k], vf_sub(u, c));
+        vf_store(&b->fy[k], vf_sub(v, r));
+        vf_store_int(&node[k], vf_add(vf_mul(r, stride), c));
+    }
+
+    int row = wind.cols + 1;
+    for (size_t k = 0; k < n; k++) {
+        const WindNode *w = &wind.nodes[node[k]];
+        b->slope[0][k] = w[0].slope;
+        b->slope[1][k] = w[1].slope;
+        b->slope[2][k] = w[row].slope;
+        b->slope[3][k] = w[row + 1].slope;
+        b->gain[0][k] = w[0].gain;
+        b->gain[1][k] = w[1].gain;
+        b->gain[2][k] = w[row].gain;
+        b->gain[3][k] = w[row + 1].gain;
+    }
+}
+
+/* Bilinear interpolation of the gathered corners j to j + VF_WIDTH */
+static inline vfloat interpolate_wind(const float corner[4][WIND_BATCH], vfloat fx, vfloat fy, size_t j) {
+    vfloat c0 = vf_load(&corner[0][j]), c1 = vf_load(&corner[1][j]);
+    vfloat c2 = vf_load(&corner[2][j]), c3 = vf_load(&corner[3][j]);
+    vfloat top = vf_add(c0, vf_mul(vf_sub(c1, c0), fx));
+    vfloat bottom = vf_add(c2, vf_mul(vf_sub(c3, c2), fx));
+    return vf_add(top, vf_mul(vf_sub(bottom, top), fy));
+}
+
+/*
+ * SIMD kernel: the same math as column_physics_scalar(), VF_WIDTH columns at
+ * a time, after gathering the wind cells of WIND_BATCH columns.  The
+ * retention test is evaluated as a mask, and sin/cos of the fall angle
+ * atan2(vx, vy) are obtained exactly as vx/|v| and vy/|v| instead of
+ * through trigonometric calls (vy is never below 50 px/s, so |v| is never
+ * zero).
+ *
+ * Tolerance against the scalar path: the wind sample and the integration
+ * are the same operations in the same order, so velocities and positions
+ * are identical unless the compiler fuses multiplies and adds in one path
+ * and not the other (make check builds both with -ffp-contract=off and
+ * compares them); the character step (dx, dy) agrees to within
+ * 1e-6 * char_height.  Bounding boxes therefore differ by less than 1e-3
+ * px, and only a column touching the retention margin can be culled one
+ * frame earlier or later.
+ */
+static void column_physics_simd(const ColumnKernelParams *p, size_t begin, size_t end) {
+    const vfloat one = vf_set1(1.0f);
+    const vfloat delta = vf_set1(p->delta);
+    const vfloat gravity_step = vf_set1(GRAVITY * p->delta);
+    const vfloat terminal = vf_set1(TERMINAL_VELOCITY);
+    const vfloat response = vf_set1(WIND_RESPONSE);
+    const vfloat neg_char_height = vf_set1(-p->char_height);
+    const vfloat tiny = vf_set1(1e-20f);
+    const vfloat min_x = vf_set1(p->min_x), max_x = vf_set1(p->max_x);
+    const vfloat min_y = vf_set1(p->min_y), max_y = vf_set1(p->max_y);
+
+    WindBatch batch;
+    size_t i = begin;
+    while (i + VF_WIDTH <= end) {
+        size_t n = end - i < WIND_BATCH ? (end - i) / VF_WIDTH * VF_WIDTH : WIND_BATCH;
+        gather_wind(i, n, &batch);
+        for (size_t j = 0; j < n; j += VF_WIDTH, i += VF_WIDTH) {
+            vfloat x = vf_load(&columns.x[i]);
+            vfloat y = vf_load(&columns.y[i]);
+            vfloat vx = vf_load(&columns.vx[i]);
+            vfloat vy = vf_load(&columns.vy[i]);
+
+            /* Gravity with terminal velocity clamp */
+            vy = vf_min(vf_add(vy, gravity_step), terminal);
+
+            /* Relaxation towards the drift of the local wind */
+            vfloat fx = vf_load(&batch.fx[j]), fy = vf_load(&batch.fy[j]);
+            vfloat slope = interpolate_wind(batch.slope, fx, fy, j);
+            vfloat gain = interpolate_wind(batch.gain, fx, fy, j);
+            vfloat target_vx = vf_mul(slope, vy);
+            vx = vf_add(vx, vf_mul(vf_mul(vf_mul(vf_sub(target_vx, vx), response), gain), delta));
+
+            /* Integrate position */
+            x = vf_add(x, vf_mul(vx, delta));
+            y = vf_add(y, vf_mul(vy, delta));
+
+            vf_store(&columns.x[i], x);
+            vf_store(&columns.y[i], y);
+            vf_store(&columns.vx[i], vx);
+            vf_store(&columns.vy[i], vy);
+
+            /* Character step along the fall direction */
+            vfloat inv_speed = vf_div(one, vf_max(vf_sqrt(vf_add(vf_mul(vx, vx), vf_mul(vy, vy))), tiny));
+            vfloat dx = vf_mul(neg_char_height, vf_mul(vx, inv_speed));
+            vfloat dy = vf_mul(neg_char_height, vf_mul(vy, inv_speed));
+
+            /* Bounding box of the column and retention mask */
+            vfloat span = vf_sub(vf_load_int(&columns.length[i]), one);
+            vfloat end_x = vf_add(x, vf_mul(span, dx));
+            vfloat end_y = vf_add(y, vf_mul(span, dy));
+            vmask keep = vm_and(vm_and(vf_cmpge(vf_max(y, end_y), min_y), vf_cmple(vf_min(y, end_y), max_y)),
+                                vm_and(vf_cmpge(vf_max(x, end_x), min_x), vf_cmple(vf_min(x, end_x), max_x)));
+            int bits = vm_bits(keep);
+            for (int k = 0; k < VF_WIDTH; k++) {
+                columns.alive[i + k] = (bits >> k) & 1;
+            }
+        }
+    }
+
+    /* Remaining columns that do not fill a whole vector */
+    column_physics_scalar(p, i, end);
+}
+#define column_physics column_physics_simd
+#else
+#define column_physics column_physics_scalar
+#endif
+
+const char *const column_kernel_name = COLUMN_KERNEL_NAME;
+
+/*
+ * Replace about half of the characters of every due column.  Mutation masks
+ * and replacement glyphs for all due columns are generated in bulk first,
+ * then applied with one select per character.
+ */
+static void mutate_glyphs(size_t num_due) {
+    if (num_due == 0) return;
+
+    size_t total = 0;
+    for (size_t d = 0; d < num_due; d++) {
+        total += columns.length[scratch.due[d]];
+    }
+    if (total > scratch.glyph_capacity) {
+        size_t new_capacity = scratch.glyph_capacity ? scratch.glyph_capacity : 256;
+        while (new_capacity < total)
+            new_capacity *= 2;
+        int *grown = storm_realloc(scratch.glyphs, new_capacity * sizeof(int));
+        if (!grown) return;
+        scratch.glyphs = grown;
+        scratch.glyph_capacity = new_capacity;
+    }
+
+    rng_fill(&glyph_lanes, scratch.masks, num_due);
+    rng_fill_indices(&glyph_lanes, scratch.glyphs, total, NUM_UNICODE_CHARS);
+
+    const int *glyphs = scratch.glyphs;
+    for (size_t d = 0; d < num_due; d++) {
+        int c = scratch.due[d];
+        int length = columns.length[c];
+        uint32_t mask = scratch.masks[d];
+        int *indices = &columns.indices[c * MAX_COLUMN_LENGTH];
+        for (int j = 0; j < length; j++) {
+            indices[j] = ((mask >> j) & 1) ? glyphs[j] : indices[j];
+        }
+        glyphs += length;
+
+        /* The column's instances were emitted before the mutation */
+        if (scratch.inst_first[c] >= 0) {
+            GlyphInstance *inst = &glyph_stream.instances[scratch.chunk_emit[c / COLUMN_CHUNK].offset +
+                                                          scratch.inst_first[c]];
+            int j0 = scratch.inst_j0[c];
+            for (int k = 0; k < scratch.inst_count[c]; k++) {
+                int j = j0 + k;
+                inst[k].glyph = (Uint16)indices[j < length ? j : length - 1];
+            }
+        }
+    }
+}
+
+/* Tail glyph color of column i: green varying by depth; the head is white */
+static inline SDL_Color column_tail_color(size_t i) {
+    int brightness = (int)(columns.depth[i] * 200) + 55;
+    if (brightness > 255) brightness = 255;
+    return (SDL_Color){ 0, (Uint8)brightness, 0, 255 };
+}
+
+/*
+ * Emit the draw instances of live column i into out and return how many
+ * were written; *first_j is the character of the first one.  The visible
+ * glyph range is solved with clip_glyph_run(), widened by the column's
+ * movement during the step so that interpolation between the previous and
+ * current positions never uncovers a missing glyph.
+ */
+static int emit_column(size_t i, GlyphInstance *out, ChunkEmit *emit, int *first_j) {
+    int length = columns.length[i];
+    int drawn = length + (glyph_ghost_alpha > 0.0f ? 1 : 0);
+    float x = columns.x[i], y = columns.y[i];
+    float mx = x - columns.prev_x[i], my = y - columns.prev_y[i];
+
+    /* Whatever its direction, the column stays within `reach` of its head */
+    float reach = (float)((drawn + 1) * char_height + char_width) + fabsf(mx) + fabsf(my);
+    if (x < -reach || x > g_screen_width + reach || y < -reach || y > g_screen_height + reach) {
+        emit->columns_culled++;
+        emit->glyphs_culled += length;
+        return 0;
+    }
+
+    /* Fall direction: sin and cos of atan2(vx, vy), without the trigonometry
+     * (vy is never below 50 px/s, so |v| is never zero) */
+    float vx = columns.vx[i], vy = columns.vy[i];
+    float inv_speed = 1.0f / sqrtf(vx * vx + vy * vy);
+    float sine = vx * inv_speed, cosine = vy * inv_speed;
+    float dx = -char_height * sine, dy = -char_height * cosine;
+
+    float scale = 0.5f + 0.5f * columns.depth[i];
+    float scaled_width = (float)(int)(char_width * scale);
+    float center_x = (float)(int)((char_width - scaled_width) / 2) + scaled_width * 0.5f;
+    float extent_x = fabsf(scaled_width * 0.5f * cosine) + fabsf(char_height * 0.5f * sine) + 1.0f;
+
+    /* Glyphs whose top edge may be on screen vertically, and whose rotated
+     * quad (plus a pixel of snapping) may reach it horizontally */
+    int j0 = 0, j1 = drawn;
+    clip_glyph_run(y, dy, -char_height - fabsf(my), g_screen_height + fabsf(my), &j0, &j1);
+    clip_glyph_run(x + center_x, dx, -extent_x - fabsf(mx), g_screen_width + extent_x + fabsf(mx), &j0, &j1);
+    if (j0 >= j1) {
+        emit->columns_culled++;
+        emit->glyphs_culled += length;
+        return 0;
+    }
+    int visible = (j1 < length ? j1 : length) - j0;  /* Ghost excluded */
+    emit->columns_drawn++;
+    emit->glyphs_culled += length - (visible > 0 ? visible : 0);
+    *first_j = j0;
+
+    SDL_Color tail = column_tail_color(i);
+    const int *indices = &columns.indices[i * MAX_COLUMN_LENGTH];
+    bool lit = light.num_bolts > 0 && lightning_illumination > 0.0f;
+
+    for (int j = j0; j < j1; j++) {
+        GlyphInstance *inst = &out[j - j0];
+        inst->x = x + j * dx;
+        inst->y = y + j * dy;
+        inst->mx = mx;
+        inst->my = my;
+        inst->sine = sine;
+        inst->cosine = cosine;
+        inst->scale = scale;
+        inst->glyph = (Uint16)indices[j < length ? j : length - 1];
+        inst->flags = j < length ? 0 : GLYPH_GHOST;
+        if (j == 0) {
+            inst->color = (SDL_Color){ 255, 255, 255, 255 };
+        } else {
+            inst->color = tail;
+        }
+        float fade = j < length ? 1.0f - glyph_tail_fade * j / length : glyph_ghost_alpha;
+        inst->color.a = (Uint8)(255 * fade);
+
+        /* Nearby bolts push the glyph towards white */
+        if (lit) {
+            float light_amount = lightning_light_at(inst->x + char_width * 0.5f, inst->y + char_height * 0.5f) *
+                                 lightning_illumination;
+            if (light_amount > 0.0f) {
+                inst->color.r += (Uint8)((255 - inst->color.r) * light_amount);
+                inst->color.g += (Uint8)((255 - inst->color.g) * light_amount);
+                inst->color.b += (Uint8)((255 - inst->color.b) * light_amount);
+            }
+        }
+    }
+    return j1 - j0;
+}
+
+/*
+ * Find out whether live column i splashes this step: which glyphs reached
+ * the ground since the last step, and whether a bolt that spawned just
+ * before it struck near the head.  The top edge of glyph j is at y + j * dy
+ * with dy = -char_height * vy / |v|, so the glyphs at or below the ground
+ * are counted in closed form for the previous and the current head.
+ */
+static bool detect_splash(size_t i, SplashEvent *event) {
+    float x = columns.x[i], y = columns.y[i];
+    event->column = (int)i;
+    event->first = event->count = 0;
+    event->struck = false;
+    if (x < -char_width || x > g_screen_width) return false;
+
+    float ground = (float)(g_screen_height - char_height);  /* Top edge of a glyph standing on the ground */
+    if (y >= ground) {
+        float vx = columns.vx[i], vy = columns.vy[i];
+        float spacing = char_height * vy / sqrtf(vx * vx + vy * vy);
+        float prev_y = columns.prev_y[i];
+        int length = columns.length[i];
+        int landed = (int)((y - ground) / spacing) + 1;
+        int before = prev_y >= ground ? (int)((prev_y - ground) / spacing) + 1 : 0;
+        if (landed > length) landed = length;
+        if (before > length) before = length;
+        event->first = before;
+        event->count = landed - before;
+    }
+    if (light.fresh && y > -char_height && y < g_screen_height)
+        event->struck = lightning_strikes_near(x + char_width * 0.5f, y + char_height * 0.5f);
+    return event->count > 0 || event->struck;
+}
+
+/* Throw up the fragments of a splashing column: splash_fragments from every
+ * glyph that reached the ground, and a burst from a struck head */
+static void splash_column(const SplashEvent *e) {
+    size_t i = (size_t)e->column;
+    float vx = columns.vx[i], vy = columns.vy[i];
+    float dx = -char_height * vx / sqrtf(vx * vx + vy * vy);
+    const int *indices = &columns.indices[i * MAX_COLUMN_LENGTH];
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Color tail = column_tail_color(i);
+    for (int j = e->first; j < e->first + e->count; j++) {
+        emit_splash(columns.x[i] + j * dx + char_width * 0.5f, g_screen_height - char_height * 0.25f,
+                    vx * SPLASH_CARRY, -SPLASH_SPEED, SPLASH_SPEED, splash_fragments, indices[j],
+                    j == 0 ? white : tail);
+    }
+    if (e->struck) {
+        emit_splash(columns.x[i] + char_width * 0.5f, columns.y[i] + char_height * 0.5f, 0.0f, 0.0f,
+                    SPLASH_STRIKE_SPEED, SPLASH_STRIKE_FRAGMENTS, indices[0], white);
+    }
+}
+
+/*
+ * Simulate one chunk of columns: physics and culling, then the draw
+ * instances, splashes and character timers of the survivors.  Runs on any
+ * worker; it only writes the chunk's own column slots and its own region of
+ * the scratch lists and of the instance buffer.
+ */
+static void simulate_chunk(void *ctx, int chunk, int worker) {
+    const ColumnKernelParams *params = ctx;
+    size_t begin = (size_t)chunk * COLUMN_CHUNK;
+    size_t end = begin + COLUMN_CHUNK;
+    if (end > columns.count) end = columns.count;
+    (void)worker;
+
+    /* Remember where every column was, so rendering can interpolate */
+    memcpy(&columns.prev_x[begin], &columns.x[begin], (end - begin) * sizeof(float));
+    memcpy(&columns.prev_y[begin], &columns.y[begin], (end - begin) * sizeof(float));
+
+    column_physics(params, begin, end);
+
+    int *due = &scratch.due[begin];
+    int *dead = &scratch.dead[begin];
+    SplashEvent *splashes = &scratch.splashes[begin];
+    int num_due = 0, num_dead = 0, num_splashes = 0;
+    bool splashing = splash_fragments > 0 && particles.x;
+    GlyphInstance *instances = &glyph_stream.instances[begin * COLUMN_MAX_INSTANCES];
+    ChunkEmit *emit = &scratch.chunk_emit[chunk];
+    memset(emit, 0, sizeof(*emit));
+    for (size_t i = begin; i < end; i++) {
+        if (!columns.alive[i]) {
+            dead[num_dead++] = (int)i;
+            continue;
+        }
+        /* Draw instances, in the same pass as the physics */
+        int emitted = emit_column(i, &instances[emit->instances], emit, &scratch.inst_j0[i]);
+        scratch.inst_first[i] = emitted > 0 ? (int)emit->instances : -1;
+        scratch.inst_count[i] = emitted;
+        emit->instances += emitted;
+
+        /* Glyphs hitting the ground and heads struck by lightning */
+        if (splashing && detect_splash(i, &splashes[num_splashes]))
+            num_splashes++;
+
+        /* Queue periodic character updates */
+        columns.char_update_timer[i] += params->delta;
+        if (columns.char_update_timer[i] > glyph_update_interval) {
+            due[num_due++] = (int)i;
+            columns.char_update_timer[i] = 0.0f;
+        }
+    }
+    scratch.chunk_due[chunk] = num_due;
+    scratch.chunk_dead[chunk] = num_dead;
+    scratch.chunk_splashes[chunk] = num_splashes;
+}
+
+/*
+ * Spawn columns to hold column_density over the spawn span, which extends
+ * the screen by the retention margin on both sides.  Columns that died this
+ * step are replaced right away; any other shortfall is made up over
+ * SPAWN_RESPONSE_TIME, but never faster than filling the whole span in
+ * SPAWN_RAMP_TIME.  Whole spawns are taken from a running budget, so they
+ * are spread evenly in time, and successive x positions follow the golden
+ * ratio sequence with a little jitter, so they never clump.
+ */
+static void schedule_spawns(float delta, int num_dead) {
+    int margin = char_height * column_margin_chars;
+    float span = (float)(g_screen_width + 2 * margin);
+    float target = column_density * span / 100.0f;
+    if (target > (float)column_cap) target = (float)column_cap;
+
+    float deficit = target - (float)columns.count;
+    if (deficit <= 0.0f) {
+        spawn_budget = 0.0f;
+        return;
+    }
+    float replace = (float)num_dead < deficit ? (float)num_dead : deficit;
+    float fill = (deficit - replace) * delta / SPAWN_RESPONSE_TIME;
+    float max_fill = target * delta / SPAWN_RAMP_TIME;
+    spawn_budget += replace + (fill < max_fill ? fill : max_fill);
+
+    int spawns = (int)spawn_budget;
+    if ((float)spawns > deficit) spawns = (int)deficit;
+    spawn_budget -= (float)spawns;
+
+    float jitter = 1.0f / target;  /* One column's share of the span */
+    for (int i = 0; i < spawns; i++) {
+        spawn_phase += 0.618034f;
+        if (spawn_phase >= 1.0f) spawn_phase -= 1.0f;
+        float u = spawn_phase + (rng_float(&rng_columns) - 0.5f) * jitter;
+        u -= floorf(u);
+        create_column((int)(u * span) - margin);
+    }
+}
+
+/* Update falling columns: position, velocity, and character content */
+void update_columns(float delta) {
+    float extended_margin = (float)(char_height * column_margin_chars);  /* Retain columns within extended bounds */
+
+    ColumnKernelParams params;
+    params.delta = delta;
+    params.char_height = (float)char_height;
+    params.min_x = -extended_margin;
+    params.max_x = g_screen_width + extended_margin;
+    params.min_y = -extended_margin;
+    params.max_y = g_screen_height + extended_margin;
+    prepare_lightning_light();
+
+    int num_chunks = (int)((columns.count + COLUMN_CHUNK - 1) / COLUMN_CHUNK);
+    pool_run(simulate_chunk, &params, num_chunks);
+
+    /* Merge the per-chunk lists.  Mutation happens before any removal, so
+     * every queued slot still refers to the column that queued it. */
+    size_t num_due = 0;
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        memmove(&scratch.due[num_due], &scratch.due[(size_t)chunk * COLUMN_CHUNK],
+                scratch.chunk_due[chunk] * sizeof(int));
+        num_due += scratch.chunk_due[chunk];
+    }
+
+    /* Compact the chunks' instances into one stream */
+    glyph_stream.count = 0;
+    glyph_stream.columns_drawn = glyph_stream.columns_culled = glyph_stream.glyphs_culled = 0;
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        ChunkEmit *emit = &scratch.chunk_emit[chunk];
+        emit->offset = glyph_stream.count;
+        memmove(&glyph_stream.instances[glyph_stream.count],
+                &glyph_stream.instances[(size_t)chunk * COLUMN_CHUNK * COLUMN_MAX_INSTANCES],
+                emit->instances * sizeof(GlyphInstance));
+        glyph_stream.count += emit->instances;
+        glyph_stream.columns_drawn += emit->columns_drawn;
+        glyph_stream.columns_culled += emit->columns_culled;
+        glyph_stream.glyphs_culled += emit->glyphs_culled;
+    }
+    mutate_glyphs(num_due);
+
+    /* Splashes in slot order, also before any removal */
+    for (int chunk = 0; chunk < num_chunks; chunk++) {
+        const SplashEvent *splashes = &scratch.splashes[(size_t)chunk * COLUMN_CHUNK];
+        for (int k = 0; k < scratch.chunk_splashes[chunk]; k++)
+            splash_column(&splashes[k]);
+    }
+
+    /* Recycle culled columns from the highest slot down: the column swapped
+     * into a freed slot always comes from above and has survived */
+    int num_dead = 0;
+    for (int chunk = num_chunks - 1; chunk >= 0; chunk--) {
+        const int *dead = &scratch.dead[(size_t)chunk * COLUMN_CHUNK];
+        for (int k = scratch.chunk_dead[chunk] - 1; k >= 0; k--) {
+            destroy_column(dead[k]);
+        }
+        num_dead += scratch.chunk_dead[chunk];
+    }
+
+    schedule_spawns(delta, num_dead);
+}
+
+/* Seed every random stream of the simulation from a single run seed */
+void storm_seed(uint64_t seed) {
+    rng_seed(&rng_columns, seed, 1);
+    rng_seed(&rng_wind, seed, 2);
+    rng_seed(&rng_lightning, seed, 3);
+    rng_seed(&rng_gusts, seed, 4);
+    rng_seed(&rng_splash, seed, 5);
+    rng_lanes_seed(&glyph_lanes, &rng_columns);
+    spawn_budget = 0.0f;
+    spawn_phase = 0.0f;
+}
+
+/*
+ * Advance the whole simulation by one step.  With a fixed delta and a fixed
+ * seed the sequence of states is fully deterministic, which is what makes
+ * seed plus step count replays possible.
+ */
+void step_simulation(float delta) {
+    Uint64 t = profile_begin();
+    update_wind(delta);
+    t = profile_end(PROFILE_WIND, t);
+    update_columns(delta);
+    t = profile_end(PROFILE_COLUMNS, t);
+    update_lightning(delta);
+    t = profile_end(PROFILE_LIGHTNING, t);
+    update_particles(delta);
+    profile_end(PROFILE_PARTICLES, t);
+    sim_steps++;
+}
+
+/* Grow the wind field to cols x rows cells; false if out of memory */
+static bool size_wind_field(int cols, int rows) {
+    size_t nodes = (size_t)(cols + 1) * (rows + 1);
+    if (nodes > wind.node_capacity) {
+        WindNode *grown = storm_realloc(wind.node_capacity ? wind.nodes : NULL, nodes * sizeof(WindNode));
+        if (!grown) return false;
+        wind.nodes = grown;
+        wind.node_capacity = nodes;
+    }
+    wind.cols = cols;
+    wind.rows = rows;
+    wind.max_u = (float)cols - 0.001f;
+    wind.max_v = (float)rows - 0.001f;
+    return true;
+}
+
+/*
+ * Start a gust or a vortex somewhere on the screen.  A gust pushes the rain
+ * one way and travels that way; a vortex pushes it one way above its center
+ * and the other way below, and drifts slowly.
+ */
+static void spawn_wind_feature(void) {
+    WindFeature *f = &wind.features[wind.num_features++];
+    f->vortex = rng_float(&rng_gusts) < 0.4f;
+    f->x = rng_float(&rng_gusts) * g_screen_width;
+    f->y = rng_float(&rng_gusts) * g_screen_height;
+    float direction = rng_float(&rng_gusts) < 0.5f ? -1.0f : 1.0f;
+    if (f->vortex) {
+        f->radius = 120.0f + rng_float(&rng_gusts) * 200.0f;
+        f->strength = direction * (0.6f + rng_float(&rng_gusts) * 1.0f);
+        f->vx = (rng_float(&rng_gusts) - 0.5f) * 60.0f;
+        f->vy = 10.0f + rng_float(&rng_gusts) * 30.0f;
+    } else {
+        f->radius = 200.0f + rng_float(&rng_gusts) * 300.0f;
+        f->strength = direction * (0.2f + rng_float(&rng_gusts) * 0.5f);
+        f->vx = direction * (120.0f + rng_float(&rng_gusts) * 160.0f);
+        f->vy = 20.0f + rng_float(&rng_gusts) * 40.0f;
+    }
+    f->age = 0.0f;
+    f->lifetime = 2.0f + rng_float(&rng_gusts) * 4.0f;
+}
+
+/* Add a feature to the nodes within its radius, faded in and out over its
+ * lifetime.  The gain is raised towards 1, so a gust also moves rain the
+ * wave front of a transition has not reached yet. */
+static void splat_wind_feature(const WindFeature *f) {
+    int node_cols = wind.cols + 1, node_rows = wind.rows + 1;
+    float envelope = sinf((float)M_PI * f->age / f->lifetime);
+    float inv_radius = 1.0f / f->radius;
+    int c0 = (int)ceilf((f->x - f->radius) / WIND_CELL_SIZE);
+    int c1 = (int)floorf((f->x + f->radius) / WIND_CELL_SIZE);
+    int r0 = (int)ceilf((f->y - f->radius) / WIND_CELL_SIZE);
+    int r1 = (int)floorf((f->y + f->radius) / WIND_CELL_SIZE);
+    if (c0 < 0) c0 = 0;
+    if (r0 < 0) r0 = 0;
+    if (c1 >= node_cols) c1 = node_cols - 1;
+    if (r1 >= node_rows) r1 = node_rows - 1;
+
+    for (int r = r0; r <= r1; r++) {
+        float dy = (r * WIND_CELL_SIZE - f->y) * inv_radius;
+        float push = f->vortex ? -2.0f * dy : 1.0f;
+        for (int c = c0; c <= c1; c++) {
+            float dx = (c * WIND_CELL_SIZE - f->x) * inv_radius;
+            float weight = 1.0f - (dx * dx + dy * dy);
+            if (weight <= 0.0f) continue;
+            weight *= weight * envelope;
+            WindNode *n = &wind.nodes[r * node_cols + c];
+            n->slope += f->strength * push * weight;
+            n->gain += (1.0f - n->gain) * weight;
+        }
+    }
+}
+
+/* Write the wind field: the base drift and wave front at every node, then
+ * the features on top */
+static void build_wind_field(void) {
+    int node_cols = wind.cols + 1, node_rows = wind.rows + 1;
+    float tan_wind = tanf(current_wind_angle * (float)M_PI / 180.0f);
+    float front, front_slope;
+    get_wind_front(&front, &front_slope);
+
+    for (int c = 0; c < node_cols; c++) {
+        float gain = 1.0f - front_slope * (c * WIND_CELL_SIZE - front);
+        wind.nodes[c].slope = tan_wind;
+        wind.nodes[c].gain = gain < 0.0f ? 0.0f : gain > 1.0f ? 1.0f : gain;
+    }
+    for (int r = 1; r < node_rows; r++)
+        memcpy(&wind.nodes[r * node_cols], wind.nodes, node_cols * sizeof(WindNode));
+    for (int i = 0; i < wind.num_features; i++)
+        splat_wind_feature(&wind.features[i]);
+}
+
+/* Advance the gusts and vortices, start new ones at wind_gust_rate, and
+ * rebuild the wind field unless it is settled and stays so */
+static void update_wind_field(float delta) {
+    for (int i = 0; i < wind.num_features;) {
+        WindFeature *f = &wind.features[i];
+        f->age += delta;
+        if (f->age >= f->lifetime) {
+            *f = wind.features[--wind.num_features];
+            continue;
+        }
+        f->x += f->vx * delta;
+        f->y += f->vy * delta;
+        i++;
+    }
+    float megapixels = (float)g_screen_width * g_screen_height * 1e-6f;
+    if (rng_float(&rng_gusts) < wind_gust_rate * megapixels * delta &&
+        wind.num_features < WIND_MAX_FEATURES)
+        spawn_wind_feature();
+
+    int cols = (int)(g_screen_width / WIND_CELL_SIZE) + 1;
+    int rows = (int)(g_screen_height / WIND_CELL_SIZE) + 1;
+    bool resized = cols != wind.cols || rows != wind.rows || wind.node_capacity == 0;
+    if (wind.settled && !resized && !wind_in_transition && wind.num_features == 0)
+        return;
+    if (resized && !size_wind_field(cols, rows))
+        return;
+    build_wind_field();
+    wind.settled = !wind_in_transition && wind.num_features == 0;
+}
+
+/* Update wind angle: idle, then transition towards a new random target.
+ * The wind field follows. */
+void update_wind(float delta) {
+    if (wind_in_transition) {
+        wind_transition_timer += delta;
+        float t = wind_transition_timer / wind_transition_duration;
+        if (t >= 1.0f) {
+            current_wind_angle = target_wind_angle;
+            wind_in_transition = false;
+            wind_idle_timer = 3.0f + rng_float(&rng_wind) * 5.0f;
+            wind_transition_timer = 0.0f;
+            wind_transition_duration = 0.0f;
+        } else {
+            current_wind_angle = wind_start_angle + (target_wind_angle - wind_start_angle) * t;
+        }
+    } else {
+        wind_idle_timer -= delta;
+        if (wind_idle_timer <= 0) {
+            wind_in_transition = true;
+            wind_transition_duration = 1.0f + (rng_float(&rng_wind) * 4.0f);
+            wind_transition_timer = 0.0f;
+            wind_start_angle = current_wind_angle;
+            target_wind_angle = -45.0f + (rng_float(&rng_wind) * 90.0f);
+        }
+    }
+    update_wind_field(delta);
+}
+
+/* Sample the wind field at (x, y): the target vx / vy of a column there and
+ * the fraction of WIND_RESPONSE it relaxes at */
+void wind_field_at(float x, float y, float *slope, float *gain) {
+    sample_wind(x, y, slope, gain);
+}
+
+int wind_feature_count(void) {
+    return wind.num_features;
+}
+
+void free_wind(void) {
+    if (wind.node_capacity) free(wind.nodes);
+    wind.nodes = calm_nodes;
+    wind.node_capacity = 0;
+    wind.cols = wind.rows = 1;
+    wind.max_u = wind.max_v = 0.999f;
+    wind.settled = false;
+}
+
+/* Lightning Effect Functions */
+
+/*
+ * Fill a bolt by midpoint displacement, one level at a time: each pass
+ * splits every segment of the previous level in two and halves the
+ * displacement, so no recursion is needed and a level touches its points in
+ * memory order.
+ *
+ * Parameters:
+ *   points         - output; must hold LIGHTNING_POINT_COUNT(detail) entries
+ *   startX, startY - starting coordinates for the lightning bolt
+ *   endX, endY     - ending coordinates for the lightning bolt
+ *   displacement   - initial displacement magnitude
+ *   detail         - number of subdivision levels (0 to LIGHTNING_MAX_DETAIL)
+ *
+ * Returns the number of points written, 2^detail + 1.
+ */
+int generate_fractal_lightning_points(SDL_FPoint *points, float startX, float startY,
+                                      float endX, float endY, float displacement, int detail) {
+    int last = 1 << detail;
+    points[0].x = startX;
+    points[0].y = startY;
+    points[last].x = endX;
+    points[last].y = endY;
+
+    for (int stride = last; stride >= 2; stride >>= 1, displacement *= 0.5f) {
+        int half = stride >> 1;
+        for (int start = 0; start < last; start += stride) {
+            SDL_FPoint A = points[start];
+            SDL_FPoint B = points[start + stride];
+
+            float midX = (A.x + B.x) / 2.0f;
+            float midY = (A.y + B.y) / 2.0f;
+
+            float dx = B.x - A.x;
+            float dy = B.y - A.y;
+            float norm = sqrtf(dx * dx + dy * dy);
+            float perpX = 0.0f, perpY = 0.0f;
+            if (norm != 0) {
+                perpX = -dy / norm;
+                perpY = dx / norm;
+            }
+
+            /* Keep the midpoint within the horizontal extent of the segment */
+            float effective_range = displacement;
+            if (fabsf(dx) > 0.001f && fabsf(perpX) > 1e-6f) {
+                float max_allowed = (fabsf(dx) / 2.0f) / fabsf(perpX);
+                effective_range = fminf(displacement, max_allowed);
+            }
+            float random_offset = rng_float(&rng_lightning) * 2.0f * effective_range - effective_range;
+            midX += perpX * random_offset;
+            midY += perpY * random_offset;
+
+            if (midY < A.y + 1) midY = A.y + 1;
+            if (midY > B.y - 1) midY = B.y - 1;
+
+            points[start + half].x = midX;
+            points[start + half].y = midY;
+        }
+    }
+    return last + 1;
+}
+
+/* Subdivision levels of a bolt's main channel: the configured
+ * lightning_detail, or enough to keep segments around 20 pixels long.
+ */
+int lightning_bolt_detail(void) {
+    if (lightning_detail > 0)
+        return lightning_detail < LIGHTNING_MAX_DETAIL ? lightning_detail : LIGHTNING_MAX_DETAIL;
+    int detail = 6;
+    while (detail < LIGHTNING_MAX_DETAIL && (1 << detail) * 20 < g_screen_height)
+        detail++;
+    return detail;
+}
+
+/* Fill a slot's index stride past its bolt's triangles with degenerate
+ * ones, which draw nothing */
+static void fill_degenerate(LightningEffect *l) {
+    int first = l->slot * lightning.slot_vertices;
+    for (int i = l->num_indices; i < lightning.slot_indices; i++)
+        l->indices[i] = first;
+}
+
+/* Subdivision levels of the branches of a bolt with `detail` levels */
+static int branch_detail_of(int detail) {
+    return detail > 4 ? detail - 3 : 1;
+}
+
+/* Branch sites of a main channel with main_count points */
+static int branch_sites_of(int main_count) {
+    return LIGHTNING_BRANCH_SITES < main_count - 1 ? LIGHTNING_BRANCH_SITES : main_count - 1;
+}
+
+/*
+ * Size the lightning pool for bolts at the current lightning_bolt_detail():
+ * every slot gets room for a bolt forking at all of its branch sites.  The
+ * arenas share one allocation and only grow; growing drops the live
+ * effects.
+ */
+bool reserve_lightning(void) {
+    int detail = lightning_bolt_detail();
+    if (lightning.branches && detail <= lightning.detail)
+        return true;
+
+    int main_count = LIGHTNING_POINT_COUNT(detail);
+    int slot_points = main_count + branch_sites_of(main_count) * LIGHTNING_POINT_COUNT(branch_detail_of(detail));
+    /* Glow and core strips of the main channel, one strip per branch */
+    int slot_vertices = 2 * (main_count + slot_points);
+    /* A strip of 2n vertices has 2n - 2 triangles, and there are at least two strips */
+    int slot_indices = 3 * (slot_vertices - 4);
+
+    size_t branches_size = (size_t)LIGHTNING_SLOTS * LIGHTNING_BRANCH_SITES * sizeof(LightningBranch);
+    size_t points_size = (size_t)LIGHTNING_SLOTS * slot_points * sizeof(SDL_FPoint);
+    size_t vertices_size = (size_t)LIGHTNING_SLOTS * slot_vertices * sizeof(SDL_Vertex);
+    size_t indices_size = (size_t)LIGHTNING_SLOTS * slot_indices * sizeof(int);
+    char *block = storm_malloc(branches_size + points_size + vertices_size + 2 * indices_size);
+    if (!block) return false;
+
+    free_lightning();
+    lightning.detail = detail;
+    lightning.slot_points = slot_points;
+    lightning.slot_vertices = slot_vertices;
+    lightning.slot_indices = slot_indices;
+    lightning.branches = (LightningBranch *)block;
+    lightning.points = (SDL_FPoint *)(block + branches_size);
+    lightning.vertices = (SDL_Vertex *)(block + branches_size + points_size);
+    lightning.indices = (int *)(block + branches_size + points_size + vertices_size);
+    lightning.batch = lightning.indices + (size_t)LIGHTNING_SLOTS * slot_indices;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        LightningEffect *l = &lightning.slots[i];
+        l->slot = i;
+        l->points = lightning.points + (size_t)i * slot_points;
+        l->branches = lightning.branches + (size_t)i * LIGHTNING_BRANCH_SITES;
+        l->vertices = lightning.vertices + (size_t)i * slot_vertices;
+        l->indices = lightning.indices + (size_t)i * slot_indices;
+    }
+    clear_lightning();
+    for (int i = 0; i < LIGHTNING_SLOTS; i++)
+        fill_degenerate(&lightning.slots[i]);
+    lightning.generation++;
+    return true;
+}
+
+/* Release the pool's arenas along with every effect */
+void free_lightning(void) {
+    unsigned generation = lightning.generation;
+    free(lightning.branches);
+    memset(&lightning, 0, sizeof(lightning));
+    lightning.generation = generation;
+    free(light.cell_start);
+    free(light.cell_fill);
+    free(light.entries);
+    free(light.segments);
+    memset(&light, 0, sizeof(light));
+}
+
+/*
+ * Build the complete triangle mesh of a bolt into its slot.  The glow and
+ * core share the main bolt's points but get their own strips so they can be
+ * drawn in one call.  The rest of the slot's index stride is filled with
+ * degenerate triangles.
+ */
+static void build_lightning_mesh(LightningEffect *l) {
+    l->num_vertices = 0;
+    l->num_indices = 0;
+    l->num_glow_vertices = 0;
+    if (l->num_points < 2) {
+        fill_degenerate(l);
+        return;
+    }
+
+    SDL_Color white = { 255, 255, 255, 255 };
+    SDL_Color glow = { 255, 255, 255, 127 };
+    int first = l->slot * lightning.slot_vertices;  /* Indices count from the start of the arena */
+    int v = 0, idx = 0;
+    idx += build_lightning_strip(l->points, l->num_points, LIGHTNING_GLOW_THICKNESS, glow,
+                                 l->vertices + v, l->indices + idx, first + v);
+    v += 2 * l->num_points;
+    l->num_glow_vertices = v;
+    idx += build_lightning_strip(l->points, l->num_points, LIGHTNING_CORE_THICKNESS, white,
+                                 l->vertices + v, l->indices + idx, first + v);
+    v += 2 * l->num_points;
+    for (int i = 0; i < l->num_branches; i++) {
+        idx += build_lightning_strip(l->branches[i].points, l->branches[i].num_points,
+                                     LIGHTNING_CORE_THICKNESS, white,
+                                     l->vertices + v, l->indices + idx, first + v);
+        v += 2 * l->branches[i].num_points;
+    }
+    l->num_vertices = v;
+    l->num_indices = idx;
+    fill_degenerate(l);
+}
+
+/* Set the mesh alpha from the remaining lifetime of the effect; the glow
+ * strip is drawn at half the alpha of the core and branches.
+ */
+void fade_lightning_mesh(LightningEffect *l) {
+    float alpha_factor = l->initial_timer > 0.0f ? l->timer / l->initial_timer : 0.0f;
+    if (alpha_factor < 0.0f) alpha_factor = 0.0f;
+    if (alpha_factor > 1.0f) alpha_factor = 1.0f;
+    Uint8 alpha = (Uint8)(255 * alpha_factor);
+    Uint8 glow_alpha = (Uint8)(alpha * 0.5f);
+
+    SDL_Vertex *v = l->vertices;
+    for (int i = 0; i < l->num_glow_vertices; i++)
+        v[i].color.a = glow_alpha;
+    for (int i = l->num_glow_vertices; i < l->num_vertices; i++)
+        v[i].color.a = alpha;
+}
+
+/* Start a new lightning effect, or return NULL if every slot is taken */
+LightningEffect *spawn_lightning(void) {
+    // Decide effect type: 50% chance for full-screen flash (type 1) otherwise bolt (type 0)
+    return spawn_lightning_of_type((int)rng_range(&rng_lightning, 2));
+}
+
+/*
+ * Generate the main channel and the branches of a bolt into its slot.
+ * Which segments fork is decided first, so the branch points can follow
+ * the main channel's without gaps.  Bolts are generated at no more than the
+ * detail the pool was sized for.
+ */
+static void generate_bolt(LightningEffect *l) {
+    int detail = lightning_bolt_detail();
+    if (detail > lightning.detail) detail = lightning.detail;
+    int branch_detail = branch_detail_of(detail);
+    int main_count = LIGHTNING_POINT_COUNT(detail);
+    int branch_count = LIGHTNING_POINT_COUNT(branch_detail);
+
+    /* Branches may start at the first point of any of LIGHTNING_BRANCH_SITES
+     * equal stretches of the main channel, so the number of branches does
+     * not grow with the detail level.
+     */
+    int num_sites = branch_sites_of(main_count);
+    int site_stride = (main_count - 1) / num_sites;
+    bool forks[LIGHTNING_BRANCH_SITES];
+    for (int i = 0; i < num_sites; i++) {
+        forks[i] = rng_range(&rng_lightning, 100) < 25;  /* 25% chance per site */
+    }
+
+    float startX = (float)rng_range(&rng_lightning, g_screen_width);
+    float endX = (float)rng_range(&rng_lightning, g_screen_width);
+    float endY = g_screen_height * (70 + (int)rng_range(&rng_lightning, 31)) / 100.0f;
+    float initial_displacement = g_screen_width / 8.0f;
+    l->num_points = generate_fractal_lightning_points(l->points, startX, 0.0f, endX, endY,
+                                                      initial_displacement, detail);
+
+    SDL_FPoint *next = l->points + main_count;
+    for (int i = 0; i < num_sites; i++) {
+        if (!forks[i]) continue;
+        SDL_FPoint start = l->points[i * site_stride];
+        float branch_angle = 1.5708f - 0.7854f + rng_float(&rng_lightning) * (0.7854f * 2);
+        float branch_length = 50.0f + (float)rng_range(&rng_lightning, 51);  /* 50 to 100 pixels */
+        float branch_endX = start.x + branch_length * cosf(branch_angle);
+        float branch_endY = start.y + branch_length * sinf(branch_angle);
+        if (branch_endX < 0) branch_endX = 0;
+        if (branch_endX > g_screen_width - 1) branch_endX = (float)(g_screen_width - 1);
+        if (branch_endY < start.y + 1) branch_endY = start.y + 1;
+        if (branch_endY > g_screen_height - 1) branch_endY = (float)(g_screen_height - 1);
+
+        LightningBranch *b = &l->branches[l->num_branches++];
+        b->points = next;
+        b->num_points = generate_fractal_lightning_points(next, start.x, start.y, branch_endX, branch_endY,
+                                                          initial_displacement / 2.0f, branch_detail);
+        next += branch_count;
+    }
+}
+
+/* Start a new lightning effect of the given type (0: bolt, 1: full-screen
+ * flash) in the first free slot, or return NULL if every slot is taken */
+LightningEffect *spawn_lightning_of_type(int effect_type) {
+    static unsigned next_serial = 0;
+    if (!lightning.branches || lightning.count == LIGHTNING_SLOTS) return NULL;
+    LightningEffect *l = lightning.slots;
+    while (l->active) l++;
+
+    l->active = true;
+    l->serial = ++next_serial;
+    l->effect_type = effect_type;
+    l->timer = effect_type == 1 ? 0.5f : 1.5f;
+    l->initial_timer = l->timer;
+    l->num_points = 0;
+    l->num_branches = 0;
+    if (effect_type == 0) {
+        generate_bolt(l);
+        build_lightning_mesh(l);
+        light.dirty = true;
+        light.spawned |= 1u << l->slot;
+    }
+    lightning.count++;
+    return l;
+}
+
+/* Return an effect's slot to the pool */
+void release_lightning(LightningEffect *l) {
+    if (!l || !l->active) return;
+    l->active = false;
+    if (l->num_points > 0) light.dirty = true;
+    light.spawned &= ~(1u << l->slot);
+    l->num_points = 0;
+    l->num_branches = 0;
+    l->num_vertices = 0;
+    l->num_glow_vertices = 0;
+    if (l->num_indices > 0) {
+        l->num_indices = 0;
+        fill_degenerate(l);
+    }
+    lightning.count--;
+}
+
+/* Release every live effect */
+void clear_lightning(void) {
+    for (int i = 0; i < LIGHTNING_SLOTS; i++)
+        release_lightning(&lightning.slots[i]);
+}
+
+/* Advance the live lightning effects, releasing those that have faded out,
+ * and start new ones at lightning_rate.  A strike that finds the pool full
+ * is skipped.
+ */
+void update_lightning(float delta) {
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        LightningEffect *l = &lightning.slots[i];
+        if (!l->active) continue;
+        l->timer -= delta;
+        if (l->timer <= 0)
+            release_lightning(l);
+    }
+
+    /* Strikes expected this step; wide screens may see several at once */
+    float expected = lightning_rate * g_screen_width / 1000.0f * delta;
+    for (; expected > 0.0f; expected -= 1.0f) {
+        if (rng_float(&rng_lightning) < expected)
+            spawn_lightning();
+    }
+}
+
+/*
+ * Fade every live bolt and gather their triangles into lightning.batch in
+ * slot order, so the whole storm draws with one call over the vertex arena.
+ * Returns the number of indices gathered.
+ */
+int batch_lightning(void) {
+    int n = 0;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        LightningEffect *l = &lightning.slots[i];
+        if (!l->active || l->num_indices == 0) continue;
+        fade_lightning_mesh(l);
+        memcpy(lightning.batch + n, l->indices, l->num_indices * sizeof(int));
+        n += l->num_indices;
+    }
+    return n;
+}
+
+/* Alpha of a white fill standing in for all live flashes: overlapping
+ * flashes composite as if drawn one over the other */
+float lightning_flash_alpha(void) {
+    float clear = 1.0f;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        if (!l->active || l->effect_type != 1) continue;
+        float alpha = l->timer / l->initial_timer;
+        if (alpha > 1.0f) alpha = 1.0f;
+        if (alpha > 0.0f) clear *= 1.0f - alpha;
+    }
+    return 1.0f - clear;
+}
+
+typedef void (*LightSegmentVisitor)(const SDL_FPoint *a, const SDL_FPoint *b, int slot);
+
+/* Whether the chord from p[i] to p[j] may stand in for the points between:
+ * no longer than LIGHT_SEGMENT_LENGTH, and none of them further than
+ * LIGHT_SEGMENT_TOLERANCE from it */
+static bool light_chord_fits(const SDL_FPoint *p, int i, int j) {
+    float dx = p[j].x - p[i].x, dy = p[j].y - p[i].y;
+    float length2 = dx * dx + dy * dy;
+    if (length2 > LIGHT_SEGMENT_LENGTH * LIGHT_SEGMENT_LENGTH) return false;
+    float inv_length2 = length2 > 0.0f ? 1.0f / length2 : 0.0f;
+    for (int k = i + 1; k < j; k++) {
+        float px = p[k].x - p[i].x, py = p[k].y - p[i].y;
+        float t = (px * dx + py * dy) * inv_length2;
+        t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+        float qx = px - t * dx, qy = py - t * dy;
+        if (qx * qx + qy * qy > LIGHT_SEGMENT_TOLERANCE * LIGHT_SEGMENT_TOLERANCE) return false;
+    }
+    return true;
+}
+
+/* Apply `visit` to the segments a polyline lights the rain with: each chord
+ * reaches as far along the polyline as light_chord_fits() allows.  Fewer
+ * segments make every query cheaper, and since every skipped point stays
+ * within the tolerance, the light differs from that of the full bolt by at
+ * most the falloff's change over LIGHT_SEGMENT_TOLERANCE. */
+static void visit_light_polyline(const SDL_FPoint *p, int n, int slot, LightSegmentVisitor visit) {
+    for (int i = 0; i < n - 1;) {
+        int j = i + 1;
+        while (j + 1 < n && light_chord_fits(p, i, j + 1)) j++;
+        visit(&p[i], &p[j], slot);
+        i = j;
+    }
+}
+
+/* Apply `visit` to the light segments of a bolt and its branches */
+static void for_each_bolt_segment(const LightningEffect *l, LightSegmentVisitor visit) {
+    visit_light_polyline(l->points, l->num_points, l->slot, visit);
+    for (int k = 0; k < l->num_branches; k++)
+        visit_light_polyline(l->branches[k].points, l->branches[k].num_points, l->slot, visit);
+}
+
+/* Cells of the light grid within the light radius of segment ab */
+static void segment_cells(const SDL_FPoint *a, const SDL_FPoint *b, int *c0, int *r0, int *c1, int *r1) {
+    const float inv_cell = 1.0f / LIGHT_CELL_SIZE;
+    float min_x = fminf(a->x, b->x) - LIGHTNING_LIGHT_RADIUS, max_x = fmaxf(a->x, b->x) + LIGHTNING_LIGHT_RADIUS;
+    float min_y = fminf(a->y, b->y) - LIGHTNING_LIGHT_RADIUS, max_y = fmaxf(a->y, b->y) + LIGHTNING_LIGHT_RADIUS;
+    *c0 = min_x > 0.0f ? (int)(min_x * inv_cell) : 0;
+    *r0 = min_y > 0.0f ? (int)(min_y * inv_cell) : 0;
+    *c1 = max_x > 0.0f ? (int)(max_x * inv_cell) : 0;
+    *r1 = max_y > 0.0f ? (int)(max_y * inv_cell) : 0;
+    if (*c1 >= light.cols) *c1 = light.cols - 1;
+    if (*r1 >= light.rows) *r1 = light.rows - 1;
+}
+
+static void count_segment(const SDL_FPoint *a, const SDL_FPoint *b, int slot) {
+    int c0, r0, c1, r1;
+    (void)slot;
+    light.num_segments++;
+    segment_cells(a, b, &c0, &r0, &c1, &r1);
+    for (int r = r0; r <= r1; r++)
+        for (int c = c0; c <= c1; c++)
+            light.cell_start[r * light.cols + c + 1]++;
+}
+
+static void insert_segment(const SDL_FPoint *a, const SDL_FPoint *b, int slot) {
+    int index = (int)light.num_segments++;
+    LightSegment *seg = &light.segments[index];
+    seg->ax = a->x;
+    seg->ay = a->y;
+    seg->dx = b->x - a->x;
+    seg->dy = b->y - a->y;
+    float length2 = seg->dx * seg->dx + seg->dy * seg->dy;
+    seg->inv_length2 = length2 > 0.0f ? 1.0f / length2 : 0.0f;
+    seg->slot = slot;
+    int c0, r0, c1, r1;
+    segment_cells(a, b, &c0, &r0, &c1, &r1);
+    for (int r = r0; r <= r1; r++)
+        for (int c = c0; c <= c1; c++)
+            light.entries[light.cell_fill[r * light.cols + c]++] = index;
+}
+
+/* Rebuild the light grid over the live bolts: count the entries of each
+ * cell, turn the counts into offsets, then fill the cells */
+static void build_light_grid(void) {
+    light.num_bolts = 0;
+    light.num_entries = 0;
+    light.num_segments = 0;
+    int cols = (int)(g_screen_width / LIGHT_CELL_SIZE) + 1;
+    int rows = (int)(g_screen_height / LIGHT_CELL_SIZE) + 1;
+    size_t cells = (size_t)cols * rows;
+    if (cells + 1 > light.cell_capacity) {
+        int *grown_start = storm_realloc(light.cell_start, (cells + 1) * sizeof(int));
+        if (!grown_start) return;
+        light.cell_start = grown_start;
+        int *grown_fill = storm_realloc(light.cell_fill, (cells + 1) * sizeof(int));
+        if (!grown_fill) return;
+        light.cell_fill = grown_fill;
+        light.cell_capacity = cells + 1;
+    }
+    light.cols = cols;
+    light.rows = rows;
+    memset(light.cell_start, 0, (cells + 1) * sizeof(int));
+
+    int num_bolts = 0;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        if (!l->active || l->num_points < 2) continue;
+        for_each_bolt_segment(l, count_segment);
+        num_bolts++;
+    }
+    for (size_t c = 0; c < cells; c++)
+        light.cell_start[c + 1] += light.cell_start[c];
+    size_t num_entries = (size_t)light.cell_start[cells];
+    if (num_entries > light.entry_capacity) {
+        size_t capacity = light.entry_capacity ? light.entry_capacity : 4096;
+        while (capacity < num_entries) capacity *= 2;
+        int *grown = storm_realloc(light.entries, capacity * sizeof(int));
+        if (!grown) return;
+        light.entries = grown;
+        light.entry_capacity = capacity;
+    }
+    if (light.num_segments > light.segment_capacity) {
+        size_t capacity = light.segment_capacity ? light.segment_capacity : 1024;
+        while (capacity < light.num_segments) capacity *= 2;
+        LightSegment *grown = storm_realloc(light.segments, capacity * sizeof(LightSegment));
+        if (!grown) return;
+        light.segments = grown;
+        light.segment_capacity = capacity;
+    }
+
+    light.num_segments = 0;
+    memcpy(light.cell_fill, light.cell_start, cells * sizeof(int));
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        if (l->active && l->num_points >= 2)
+            for_each_bolt_segment(l, insert_segment);
+    }
+    light.num_entries = num_entries;
+    light.num_bolts = num_bolts;
+}
+
+/*
+ * Bring the light grid up to date with the live bolts and take this step's
+ * brightness of each bolt from its remaining lifetime.  Bolts spawned since
+ * the last call become the fresh ones lightning_strikes_near() looks for.
+ * Called between steps; both queries may then run on any thread.
+ */
+void prepare_lightning_light(void) {
+    bool resized = light.cols != (int)(g_screen_width / LIGHT_CELL_SIZE) + 1 ||
+                   light.rows != (int)(g_screen_height / LIGHT_CELL_SIZE) + 1;
+    if (light.dirty || (light.num_bolts > 0 && resized)) {
+        build_light_grid();
+        light.dirty = false;
+    }
+    light.fresh = light.spawned;
+    light.spawned = 0;
+    for (int i = 0; i < LIGHTNING_SLOTS; i++) {
+        const LightningEffect *l = &lightning.slots[i];
+        float fade = l->active && l->initial_timer > 0.0f ? l->timer / l->initial_timer : 0.0f;
+        light.fade[i] = fade < 0.0f ? 0.0f : fade > 1.0f ? 1.0f : fade;
+    }
+}
+
+/*
+ * Light falling on (x, y) from the nearest bolt segments, 0 to 1: each
+ * segment within LIGHTNING_LIGHT_RADIUS contributes its bolt's fade times a
+ * smooth falloff with distance, and the brightest contribution wins.
+ */
+float lightning_light_at(float x, float y) {
+    if (light.num_bolts == 0 || x < 0.0f || y < 0.0f) return 0.0f;
+    int c = (int)(x * (1.0f / LIGHT_CELL_SIZE));
+    int r = (int)(y * (1.0f / LIGHT_CELL_SIZE));
+    if (c >= light.cols || r >= light.rows) return 0.0f;
+    int cell = r * light.cols + c;
+
+    const float inv_radius2 = 1.0f / (LIGHTNING_LIGHT_RADIUS * LIGHTNING_LIGHT_RADIUS);
+    float best = 0.0f;
+    for (int e = light.cell_start[cell]; e < light.cell_start[cell + 1]; e++) {
+        const LightSegment *seg = &light.segments[light.entries[e]];
+        float px = x - seg->ax, py = y - seg->ay;
+        float t = (px * seg->dx + py * seg->dy) * seg->inv_length2;
+        t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+        float qx = px - t * seg->dx, qy = py - t * seg->dy;
+        float falloff = 1.0f - (qx * qx + qy * qy) * inv_radius2;
+        if (falloff <= 0.0f) continue;
+        float lit = light.fade[seg->slot] * falloff * falloff;
+        if (lit > best) best = lit;
+    }
+    return best;
+}
+
+/* Whether a bolt that spawned just before this step passes within
+ * SPLASH_STRIKE_RADIUS of (x, y) */
+bool lightning_strikes_near(float x, float y) {
+    if (!light.fresh || light.num_bolts == 0 || x < 0.0f || y < 0.0f) return false;
+    int c = (int)(x * (1.0f / LIGHT_CELL_SIZE));
+    int r = (int)(y * (1.0f / LIGHT_CELL_SIZE));
+    if (c >= light.cols || r >= light.rows) return false;
+    int cell = r * light.cols + c;
+
+    const float radius2 = SPLASH_STRIKE_RADIUS * SPLASH_STRIKE_RADIUS;
+    for (int e = light.cell_start[cell]; e < light.cell_start[cell + 1]; e++) {
+        const LightSegment *seg = &light.segments[light.entries[e]];
+        if (!((light.fresh >> seg->slot) & 1)) continue;
+        float px = x - seg->ax, py = y - seg->ay;
+        float t = (px * seg->dx + py * seg->dy) * seg->inv_length2;
+        t = t < 0.0f ? 0.0f : t > 1.0f ? 1.0f : t;
+        float qx = px - t * seg->dx, qy = py - t * seg->dy;
+        if (qx * qx + qy * qy < radius2) return true;
+    }
+    return false;
+}
+
+/*
+ * Build a triangle strip along a polyline with varying thickness: the
+ * thickness is highest in the center (at progress = 0.5) and tapers down to
+ * a minimum at the ends (progress = 0 and 1).
+ *
+ * vertices must hold 2 * n entries and indices (2 * n - 2) * 3 entries.
+ * Indices are offset by first_vertex, the position of vertices[0] within the
+ * mesh the strip is part of.  Returns the number of indices written.
+ */
+int build_lightning_strip(const SDL_FPoint *points, int n, int max_thickness, SDL_Color color,
+                          SDL_Vertex *vertices, int *indices, int first_vertex) {
+    if (n < 2) return 0;
+    int vertex_count = n * 2;
+    const float min_thickness = 1.0f;  // Minimum thickness at the bolt's edges
+
+    for (int i = 0; i < n; i++) {
+        SDL_FPoint p = points[i];
+        float progress = (float)i / (n - 1);
+        float local_thickness = min_thickness + (max_thickness - min_thickness) * (1.0f - fabsf(2.0f * progress - 1.0f));
+
+        float tangent_x, tangent_y;
+        if (i == 0) {
+            tangent_x = points[i+1].x - p.x;
+            tangent_y = points[i+1].y - p.y;
+        } else if (i == n - 1) {
+            tangent_x = p.x - points[i-1].x;
+            tangent_y = p.y - points[i-1].y;
+        } else {
+            tangent_x = points[i+1].x - points[i-1].x;
+            tangent_y = points[i+1].y - points[i-1].y;
+        }
+        float len = sqrtf(tangent_x * tangent_x + tangent_y * tangent_y);
+        if (len == 0) { tangent_x = 1.0f; tangent_y = 0.0f; len = 1.0f; }
+        tangent_x /= len;
+        tangent_y /= len;
+
+        float normal_x = -tangent_y;
+        float normal_y = tangent_x;
+
+        vertices[2 * i].position.x = p.x + normal_x * local_thickness;
+        vertices[2 * i].position.y = p.y + normal_y * local_thickness;
+        vertices[2 * i].color = color;
+
+        vertices[2 * i + 1].position.x = p.x - normal_x * local_thickness;
+        vertices[2 * i + 1].position.y = p.y - normal_y * local_thickness;
+        vertices[2 * i + 1].color = color;
+    }
+
+    int idx = 0;
+    for (int i = 0; i < vertex_count - 2; i++) {
+        int base = first_vertex + i;
+        if (i % 2 == 0) {
+            indices[idx++] = base;
+            indices[idx++] = base + 1;
+            indices[idx++] = base + 2;
+        } else {
+            indices[idx++] = base + 1;
+            indices[idx++] = base;
+            indices[idx++] = base + 2;
+        }
+    }
+    return idx;
+}
+
+/* Splash Particles */
+
+/* Bytes left between consecutive particle arrays.  The arrays are whole
+ * pages long, so without the stagger every one would start at the same
+ * offset within a 4 KB page, and the passes that read and write several of
+ * them at the same index would stall on false store-to-load aliasing. */
+#define PARTICLE_ARRAY_STAGGER 192
+
+/* Carve the next array of PARTICLE_CAPACITY elements of `size` bytes from
+ * the pool's block */
+static void *carve_particle_array(char **cursor, size_t size) {
+    void *array = *cursor;
+    *cursor += PARTICLE_CAPACITY * size + PARTICLE_ARRAY_STAGGER;
+    return array;
+}
+
+/* Allocate the particle pool for PARTICLE_CAPACITY particles, once, as one
+ * block holding all 16 arrays and glyph_stream's fragment instances.  Does
+ * nothing while splash_fragments is 0. */
+bool reserve_particles(void) {
+    if (particles.x || splash_fragments == 0) return true;
+    size_t element = 12 * sizeof(float) + 2 * sizeof(Uint16) + sizeof(SDL_Color) + sizeof(int) +
+                     sizeof(GlyphInstance);
+    char *cursor = storm_malloc(PARTICLE_CAPACITY * element + 17 * PARTICLE_ARRAY_STAGGER);
+    if (!cursor) return false;
+    particles.x = carve_particle_array(&cursor, sizeof(float));  /* Owns the block */
+    particles.y = carve_particle_array(&cursor, sizeof(float));
+    particles.prev_x = carve_particle_array(&cursor, sizeof(float));
+    particles.prev_y = carve_particle_array(&cursor, sizeof(float));
+    particles.vx = carve_particle_array(&cursor, sizeof(float));
+    particles.vy = carve_particle_array(&cursor, sizeof(float));
+    particles.sine = carve_particle_array(&cursor, sizeof(float));
+    particles.cosine = carve_particle_array(&cursor, sizeof(float));
+    particles.spin = carve_particle_array(&cursor, sizeof(float));
+    particles.life = carve_particle_array(&cursor, sizeof(float));
+    particles.fade = carve_particle_array(&cursor, sizeof(float));
+    particles.scale = carve_particle_array(&cursor, sizeof(float));
+    particles.glyph = carve_particle_array(&cursor, sizeof(Uint16));
+    particles.flags = carve_particle_array(&cursor, sizeof(Uint16));
+    particles.color = carve_particle_array(&cursor, sizeof(SDL_Color));
+    particles.dead = carve_particle_array(&cursor, sizeof(int));
+    glyph_stream.fragment_instances = carve_particle_array(&cursor, sizeof(GlyphInstance));
+    glyph_stream.fragments = 0;
+    particles.count = 0;
+    return true;
+}
+
+/* Release the particle pool */
+void free_particles(void) {
+    free(particles.x);
+    memset(&particles, 0, sizeof(particles));
+    glyph_stream.fragment_instances = NULL;
+    glyph_stream.fragments = 0;
+}
+
+/* Lowest center of a particle: a quarter cell above the bottom edge */
+static inline float particle_ground(void) {
+    return g_screen_height - char_height * 0.25f;
+}
+
+/*
+ * Throw `count` fragments of a glyph from (x, y), raised to the ground if
+ * it lies below so that no step starts under it: each flies off at (vx, vy)
+ * plus half to all of `speed` in a random direction, spinning and showing a
+ * random quarter of the glyph, and fades out over half a second to a
+ * second.  Fragments that find the pool full are dropped.
+ */
+void emit_splash(float x, float y, float vx, float vy, float speed, int count, int glyph,
+                 SDL_Color color) {
+    float ground = particle_ground();
+    if (y > ground) y = ground;
+    for (int k = 0; k < count; k++) {
+        if (!particles.x || particles.count == PARTICLE_CAPACITY) {
+            particles.emitted += (unsigned long long)k;
+            particles.dropped += (unsigned long long)(count - k);
+            return;
+        }
+        size_t i = particles.count++;
+        float angle = rng_float(&rng_splash) * 6.2831853f;
+        float v = speed * (0.5f + 0.5f * rng_float(&rng_splash));
+        float lifetime = 0.5f + 0.5f * rng_float(&rng_splash);
+        particles.x[i] = x;
+        particles.y[i] = y;
+        particles.vx[i] = vx + v * cosf(angle);
+        particles.vy[i] = vy + v * sinf(angle);
+        particles.sine[i] = 0.0f;
+        particles.cosine[i] = 1.0f;
+        particles.spin[i] = (rng_float(&rng_splash) * 2.0f - 1.0f) * PARTICLE_MAX_SPIN;
+        particles.life[i] = lifetime;
+        particles.fade[i] = 1.0f / lifetime;
+        particles.scale[i] = 0.6f + 0.4f * rng_float(&rng_splash);
+        particles.glyph[i] = (Uint16)glyph;
+        particles.flags[i] = (Uint16)(GLYPH_FRAGMENT | (rng_range(&rng_splash, 4) << GLYPH_QUARTER_SHIFT));
+        particles.color[i] = color;
+    }
+    particles.emitted += (unsigned long long)count;
+}
+
+/* Per-step inputs of the particle kernel */
+typedef struct {
+    float delta;              /* Time step in seconds */
+    float ground;             /* Lowest center of a particle */
+    float min_x, max_x;       /* Horizontal retention bounds */
+} ParticleKernelParams;
+
+/*
+ * Scalar reference particle kernel: gravity, integration, a bounce off the
+ * ground, the spin and the retention test of particles [begin, end).  The
+ * position before the step is kept, so a bounce interpolates along the path
+ * actually taken rather than back through the ground.  Slots of particles
+ * that faded out or left the retention bounds are appended to
+ * particles.dead after the first num_dead, and the new total is returned.
+ * Branch-free: the bounce is a pair of selects, every slot is written to
+ * the dead list and only the dead advance it, and the orientation turns by
+ * spin * delta to first order and is renormalized rather than recomputed
+ * with trigonometry.
+ */
+static size_t particle_physics_scalar(const ParticleKernelParams *p, size_t begin, size_t end,
+                                      size_t num_dead) {
+    float delta = p->delta, ground = p->ground;
+    for (size_t i = begin; i < end; i++) {
+        float vx = particles.vx[i];
+        float vy = particles.vy[i] + PARTICLE_GRAVITY * delta;
+        float old_x = particles.x[i], old_y = particles.y[i];
+        float x = old_x + vx * delta;
+        float y = old_y + vy * delta;
+
+        bool hit = y >= ground;
+        particles.prev_x[i] = old_x;
+        particles.prev_y[i] = old_y;
+        particles.x[i] = x;
+        particles.y[i] = hit ? ground : y;
+        particles.vx[i] = hit ? vx * PARTICLE_FRICTION : vx;
+        particles.vy[i] = hit ? -fabsf(vy) * PARTICLE_RESTITUTION : vy;
+
+        float turn = particles.spin[i] * delta;
+        float s = particles.sine[i], c = particles.cosine[i];
+        float ts = s + c * turn, tc = c - s * turn;
+        float inv_norm = 1.0f / sqrtf(ts * ts + tc * tc);
+        particles.sine[i] = ts * inv_norm;
+        particles.cosine[i] = tc * inv_norm;
+        float life = particles.life[i] - delta;
+        particles.life[i] = life;
+
+        particles.dead[num_dead] = (int)i;
+        num_dead += !((life > 0.0f) & (x >= p->min_x) & (x <= p->max_x));
+    }
+    return num_dead;
+}
+
+#ifdef VF_WIDTH
+/* SIMD particle kernel on the vector abstraction of the column kernel: the
+ * same operations as particle_physics_scalar() in the same order, so both
+ * give the same results */
+static size_t particle_physics_simd(const ParticleKernelParams *p, size_t begin, size_t end,
+                                    size_t num_dead) {
+    const vfloat one = vf_set1(1.0f);
+    const vfloat zero = vf_set1(0.0f);
+    const vfloat delta = vf_set1(p->delta);
+    const vfloat gravity_step = vf_set1(PARTICLE_GRAVITY * p->delta);
+    const vfloat ground = vf_set1(p->ground);
+    const vfloat friction = vf_set1(PARTICLE_FRICTION);
+    const vfloat restitution = vf_set1(PARTICLE_RESTITUTION);
+    const vfloat min_x = vf_set1(p->min_x), max_x = vf_set1(p->max_x);
+
+    size_t i = begin;
+    for (; i + VF_WIDTH <= end; i += VF_WIDTH) {
+        vfloat vx = vf_load(&particles.vx[i]);
+        vfloat vy = vf_add(vf_load(&particles.vy[i]), gravity_step);
+        vfloat old_x = vf_load(&particles.x[i]), old_y = vf_load(&particles.y[i]);
+        vfloat x = vf_add(old_x, vf_mul(vx, delta));
+        vfloat y = vf_add(old_y, vf_mul(vy, delta));
+
+        /* Bounce: -|vy| is min(vy, -vy) */
+        vmask hit = vf_cmpge(y, ground);
+        vf_store(&particles.prev_x[i], old_x);
+        vf_store(&particles.prev_y[i], old_y);
+        vf_store(&particles.x[i], x);
+        vf_store(&particles.y[i], vf_select(hit, ground, y));
+        vf_store(&particles.vx[i], vf_select(hit, vf_mul(vx, friction), vx));
+        vf_store(&particles.vy[i], vf_select(hit, vf_mul(vf_min(vy, vf_sub(zero, vy)), restitution), vy));
+
+        vfloat turn = vf_mul(vf_load(&particles.spin[i]), delta);
+        vfloat s = vf_load(&particles.sine[i]), c = vf_load(&particles.cosine[i]);
+        vfloat ts = vf_add(s, vf_mul(c, turn)), tc = vf_sub(c, vf_mul(s, turn));
+        vfloat inv_norm = vf_div(one, vf_sqrt(vf_add(vf_mul(ts, ts), vf_mul(tc, tc))));
+        vf_store(&particles.sine[i], vf_mul(ts, inv_norm));
+        vf_store(&particles.cosine[i], vf_mul(tc, inv_norm));
+        vfloat life = vf_sub(vf_load(&particles.life[i]), delta);
+        vf_store(&particles.life[i], life);
+
+        int keep = vm_bits(vm_and(vf_cmpge(x, min_x), vf_cmple(x, max_x))) & ~vm_bits(vf_cmple(life, zero));
+        for (int k = 0; k < VF_WIDTH; k++) {
+            particles.dead[num_dead] = (int)(i + k);
+            num_dead += !((keep >> k) & 1);
+        }
+    }
+
+    /* Remaining particles that do not fill a whole vector */
+    return particle_physics_scalar(p, i, end, num_dead);
+}
+#define particle_physics particle_physics_simd
+#else
+#define particle_physics particle_physics_scalar
+#endif
+
+/* Remove particle p by moving the last live particle into its slot */
+static void destroy_particle(size_t p) {
+    size_t last = --particles.count;
+    particles.x[p] = particles.x[last];
+    particles.y[p] = particles.y[last];
+    particles.prev_x[p] = particles.prev_x[last];
+    particles.prev_y[p] = particles.prev_y[last];
+    particles.vx[p] = particles.vx[last];
+    particles.vy[p] = particles.vy[last];
+    particles.sine[p] = particles.sine[last];
+    particles.cosine[p] = particles.cosine[last];
+    particles.spin[p] = particles.spin[last];
+    particles.life[p] = particles.life[last];
+    particles.fade[p] = particles.fade[last];
+    particles.scale[p] = particles.scale[last];
+    particles.glyph[p] = particles.glyph[last];
+    particles.flags[p] = particles.flags[last];
+    particles.color[p] = particles.color[last];
+}
+
+/*
+ * Advance the splash particles by one step and write them to glyph_stream
+ * as fragments.  The kernel lists the particles that faded out or left the
+ * screen's width, and they are recycled from the highest slot down as in
+ * update_columns(), so only the dead and the particles moved into their
+ * slots are touched.  The instances, with each particle's displacement
+ * over the step as its movement, are written in a final pass over the
+ * survivors.
+ */
+void update_particles(float delta) {
+    if (!particles.x) return;
+    ParticleKernelParams params;
+    params.delta = delta;
+    params.ground = particle_ground();
+    params.min_x = (float)-char_width;
+    params.max_x = (float)(g_screen_width + char_width);
+    size_t num_dead = particle_physics(&params, 0, particles.count, 0);
+    while (num_dead > 0)
+        destroy_particle((size_t)particles.dead[--num_dead]);
+
+    /* The arrays in locals, so the instance stores need not reload them */
+    const float *x = particles.x, *y = particles.y, *prev_x = particles.prev_x, *prev_y = particles.prev_y;
+    const float *sine = particles.sine, *cosine = particles.cosine, *scale = particles.scale;
+    const float *life = particles.life, *fade = particles.fade;
+    const Uint16 *glyph = particles.glyph, *flags = particles.flags;
+    const SDL_Color *color = particles.color;
+    GlyphInstance *out = glyph_stream.fragment_instances;
+    size_t count = particles.count;
+    for (size_t i = 0; i < count; i++) {
+        SDL_Color rgba = color[i];
+        rgba.a = (Uint8)(255.0f * life[i] * fade[i]);
+        out[i] = (GlyphInstance){ x[i], y[i], x[i] - prev_x[i], y[i] - prev_y[i], sine[i], cosine[i], scale[i],
+                                  rgba, glyph[i], flags[i] };
+    }
+    glyph_stream.fragments = particles.count;
+}
@@ -0,0 +1,291 @@
+/*
+ * storm_sim.h
+ *
+ * Simulation and geometry for the Matrix Rain effect: falling columns, wind,
+ * lightning and splashes.  Shared by the SDL renderer (matrix_storm.c) and the
+ * headless benchmark (storm_bench.c); nothing in here opens a window or
+ * touches an SDL_Renderer.
+ */
+
+#ifndef STORM_SIM_H
+#define STORM_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL2/SDL.h>
+
+#include "storm_rng.h"
+
+/* Global physics constants */
+#define GRAVITY 10.0f
+#define TERMINAL_VELOCITY 100.0f
+#define WIND_RESPONSE 2.0f
+
+/* Number of entries in unicode_chars */
+#define NUM_UNICODE_CHARS 303
+
+/* Fixed simulation time step in seconds */
+#define SIM_STEP (1.0f / 60.0f)
+
+/* Default hard limit on live columns */
+#define COLUMN_CAP_DEFAULT 2048
+
+/* Longest possible column; fixed stride of the shared glyph-index slab */
+#define MAX_COLUMN_LENGTH 28
+
+/* Maximum half-width of the lightning core and of its surrounding glow */
+#define LIGHTNING_CORE_THICKNESS 3
+#define LIGHTNING_GLOW_THICKNESS (LIGHTNING_CORE_THICKNESS + 4)
+
+/* Subdivision levels of a bolt and the resulting number of points */
+#define LIGHTNING_MAX_DETAIL 10
+#define LIGHTNING_POINT_COUNT(detail) ((1 << (detail)) + 1)
+
+/* Number of places along the main channel where a branch may fork */
+#define LIGHTNING_BRANCH_SITES 64
+
+/* Most lightning effects alive at once.  The GPU renderer sizes shader
+ * arrays by it, so it is fixed at compile time. */
+#define LIGHTNING_SLOTS 32
+
+/* Default strikes per second per 1000 px of screen width */
+#define LIGHTNING_RATE_DEFAULT 0.2f
+
+/* Distance in pixels over which a bolt lights up the rain */
+#define LIGHTNING_LIGHT_RADIUS 96.0f
+
+/* Cell size of the wind field in pixels */
+#define WIND_CELL_SIZE 64.0f
+
+/* Most gusts and vortices alive at once */
+#define WIND_MAX_FEATURES 16
+
+/* Default gusts and vortices started per second per megapixel of screen */
+#define WIND_GUST_RATE_DEFAULT 0.5f
+
+/* Most splash particles alive at once */
+#define PARTICLE_CAPACITY 131072
+
+/* Default fragments thrown up by a glyph hitting the ground */
+#define SPLASH_FRAGMENTS_DEFAULT 3
+
+/* Data Structures */
+
+/* Pool of falling columns for matrix rain, stored as a structure of arrays.
+ * Live columns occupy slots [0, count); removal swaps the last live column
+ * into the freed slot, so the arrays stay dense and are never shrunk.
+ */
+typedef struct {
+    float *x;                 /* Horizontal position (head) in pixels */
+    float *y;                 /* Vertical position (head) in pixels */
+    float *prev_x;            /* Position before the last step, for interpolation */
+    float *prev_y;
+    float *vx;                /* Horizontal velocity (pixels/s) */
+    float *vy;                /* Vertical velocity (pixels/s) */
+    float *depth;             /* Brightness factor (0.0 to 1.0) */
+    float *char_update_timer; /* Timer for character updates */
+    int *length;              /* Number of characters in the column */
+    unsigned char *alive;     /* Cull result of the last physics step */
+    int *indices;             /* Indices into unicode_chars, MAX_COLUMN_LENGTH per column */
+    size_t count;             /* Number of live columns */
+    size_t capacity;          /* Number of allocated slots */
+} ColumnPool;
+
+/* Lightning branch structure */
+typedef struct {
+    SDL_FPoint *points;       /* Points within the bolt's point arena */
+    int num_points;
+} LightningBranch;
+
+/* Lightning effect representation; one slot of the lightning pool */
+typedef struct {
+    bool active;              /* The slot holds a live effect */
+    int slot;                 /* Index of the slot in lightning.slots */
+    float timer;              /* Remaining time for the effect */
+    float initial_timer;      /* Initial duration */
+    int effect_type;          /* 0: bolt, 1: full-screen flash */
+    SDL_FPoint *points;       /* Main bolt points, followed by the branch points */
+    int num_points;           /* Number of main bolt points */
+
+    /* Precomputed branches (constant during the effect) */
+    LightningBranch *branches;
+    int num_branches;
+
+    /* Triangle mesh of the whole bolt, built once at generation: the glow
+     * strip first, then the core and branch strips.  Only the vertex alpha
+     * changes while the effect fades.  Indices count from the start of the
+     * pool's vertex arena, not from `vertices`.  Empty for flashes.
+     */
+    SDL_Vertex *vertices;
+    int *indices;
+    int num_vertices;
+    int num_indices;
+    int num_glow_vertices;    /* Leading vertices drawn at half alpha */
+    unsigned serial;          /* Unique per effect, so caches of the mesh can tell bolts apart */
+} LightningEffect;
+
+/* Fixed pool of concurrent lightning effects.  Slot i owns the i-th stride
+ * of each arena, sized for the largest bolt at `detail`, so spawning and
+ * expiring effects never allocate.  The index stride of a slot past its
+ * bolt's triangles (all of it for a free slot or a flash) holds degenerate
+ * triangles, so any prefix of whole slots of the index arena can be drawn
+ * as it is.
+ */
+typedef struct {
+    LightningEffect slots[LIGHTNING_SLOTS];
+    int count;                /* Live effects */
+    int detail;               /* Subdivision levels the slots are sized for */
+    int slot_points, slot_vertices, slot_indices;  /* Per-slot strides of the arenas */
+    LightningBranch *branches;  /* LIGHTNING_BRANCH_SITES per slot; owns all the arenas */
+    SDL_FPoint *points;
+    SDL_Vertex *vertices;
+    int *indices;
+    int *batch;               /* Live triangles gathered by batch_lightning() */
+    unsigned generation;      /* Changes whenever the arenas are reallocated */
+} LightningPool;
+
+/* One glyph to draw, emitted by update_columns() */
+typedef struct {
+    float x, y;               /* Top-left of the glyph cell at the end of the step */
+    float mx, my;             /* Movement of the column during the step, for interpolation */
+    float sine, cosine;       /* Fall direction; the quad is rotated by -atan2(sine, cosine) */
+    float scale;              /* Depth scale of the glyph width */
+    SDL_Color color;
+    Uint16 glyph;             /* Index into unicode_chars */
+    Uint16 flags;             /* GLYPH_* */
+} GlyphInstance;
+
+#define GLYPH_GHOST 1         /* Fading copy in the slot the column just vacated */
+#define GLYPH_FRAGMENT 2      /* Splash particle: a quarter of the glyph, centered on (x, y) and
+                               * scaled both ways; mx, my are its movement */
+#define GLYPH_QUARTER_SHIFT 2 /* Bits 2 and 3 of a fragment's flags: which quarter it shows */
+
+/* Glyphs in view after the last simulation step, in column slot order,
+ * and the splash fragments, which are drawn after them in the same batch */
+typedef struct {
+    GlyphInstance *instances;
+    size_t count;
+    GlyphInstance *fragment_instances;  /* Part of the particle pool's block; NULL without one */
+    size_t fragments;
+    size_t columns_drawn;     /* Columns with at least one glyph in view */
+    size_t columns_culled;    /* Columns entirely out of view */
+    size_t glyphs_culled;     /* Glyphs of live columns out of view, ghosts excluded */
+} GlyphStream;
+
+/* Splash particles: glyph fragments thrown up where columns hit the ground
+ * and where lightning strikes near a column's head.  A fixed pool stored as
+ * a structure of arrays and allocated once by reserve_particles(), only
+ * when splashes are on; live particles occupy [0, count), and as with
+ * columns a dead particle's slot is refilled from the end.  Emission into
+ * a full pool is dropped.
+ */
+typedef struct {
+    float *x, *y;             /* Center in pixels */
+    float *prev_x, *prev_y;   /* Center before the last step, for interpolation */
+    float *vx, *vy;           /* Velocity in pixels/s */
+    float *sine, *cosine;     /* Orientation */
+    float *spin;              /* Angular velocity in radians/s */
+    float *life;              /* Seconds left */
+    float *fade;              /* 1 / lifetime */
+    float *scale;             /* Size relative to a quarter of the character cell */
+    Uint16 *glyph;            /* Index into unicode_chars */
+    Uint16 *flags;            /* GLYPH_FRAGMENT and the quarter shown */
+    SDL_Color *color;
+    int *dead;                /* Slots freed by the last step */
+    size_t count;
+    unsigned long long emitted;  /* Since startup */
+    unsigned long long dropped;  /* Emissions that found the pool full */
+} ParticlePool;
+
+/* Global Variables */
+
+extern const char *unicode_chars[];  /* NUM_UNICODE_CHARS entries */
+
+extern int g_screen_width, g_screen_height;  /* Simulated screen size in pixels */
+extern int char_width, char_height;          /* Character dimensions (monospace) */
+
+extern ColumnPool columns;                   /* Active falling columns */
+extern float column_density;                 /* Target live columns per 100 px of spawn span */
+extern int column_cap;                       /* Hard limit on live columns */
+extern int column_margin_chars;              /* Off-screen retention margin in characters */
+extern float glyph_update_interval;          /* Seconds between glyph mutations of a column */
+
+extern GlyphStream glyph_stream;             /* Draw instances of the last step */
+extern float glyph_tail_fade;                /* Alpha lost from head to last glyph; 0 = opaque */
+extern float glyph_ghost_alpha;              /* Alpha of ghost glyphs; 0 = none emitted */
+
+extern LightningPool lightning;              /* Live lightning effects */
+extern int lightning_detail;                 /* Bolt subdivision levels; 0 = from screen height */
+extern float lightning_rate;                 /* Strikes per second per 1000 px of width */
+extern float lightning_illumination;         /* Brightening of glyphs right at a bolt; 0 = none */
+
+extern ParticlePool particles;               /* Live splash particles */
+extern int splash_fragments;                 /* Fragments per glyph hitting the ground; 0 = no splashes */
+
+extern float current_wind_angle;             /* Current wind angle (degrees) */
+extern float wind_gust_rate;                 /* Gusts and vortices per second per megapixel */
+
+extern const char *const column_kernel_name; /* Instruction set of the physics kernel */
+
+/* Independent random streams of the simulation */
+extern StormRng rng_columns;                 /* Column spawning and glyph selection */
+extern StormRng rng_wind;                    /* Wind timing and targets */
+extern StormRng rng_lightning;               /* Lightning spawning and shape */
+extern StormRng rng_gusts;                   /* Gusts and vortices of the wind field */
+extern StormRng rng_splash;                  /* Splash particles */
+
+/* Number of fixed steps simulated since startup */
+extern unsigned long long sim_steps;
+
+/* Number of heap allocations made by the simulation so far; the renderers,
+ * the exporter and the atlas loader allocate on their own */
+extern unsigned long sim_allocations;
+
+/* Columns */
+int random_unicode_index(void);
+bool reserve_columns(size_t capacity);
+void free_columns(void);
+int create_column(int col_index);
+void destroy_column(size_t c);
+void update_columns(float delta);
+void clip_glyph_run(float start, float step, float lo, float hi, int *j0, int *j1);
+
+/* Simulation */
+void storm_seed(uint64_t seed);
+void step_simulation(float delta);
+
+/* Wind */
+void update_wind(float delta);
+void wind_field_at(float x, float y, float *slope, float *gain);
+int wind_feature_count(void);
+void free_wind(void);
+
+/* Lightning */
+int generate_fractal_lightning_points(SDL_FPoint *points, float startX, float startY,
+                                      float endX, float endY, float displacement, int detail);
+int lightning_bolt_detail(void);
+bool reserve_lightning(void);
+void free_lightning(void);
+LightningEffect *spawn_lightning(void);
+LightningEffect *spawn_lightning_of_type(int effect_type);
+void release_lightning(LightningEffect *l);
+void clear_lightning(void);
+void update_lightning(float delta);
+int batch_lightning(void);
+float lightning_flash_alpha(void);
+void prepare_lightning_light(void);
+float lightning_light_at(float x, float y);
+bool lightning_strikes_near(float x, float y);
+int build_lightning_strip(const SDL_FPoint *points, int n, int max_thickness, SDL_Color color,
+                          SDL_Vertex *vertices, int *indices, int first_vertex);
+void fade_lightning_mesh(LightningEffect *l);
+
+/* Splashes */
+bool reserve_particles(void);
+void free_particles(void);
+void emit_splash(float x, float y, float vx, float vy, float speed, int count, int glyph,
+                 SDL_Color color);
+void update_particles(float delta);
+
+#endif /* STORM_SIM_H */